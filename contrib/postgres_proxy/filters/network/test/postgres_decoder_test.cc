@@ -643,6 +643,7 @@ public:
   MOCK_METHOD(void, addBufferFragment, (Buffer::BufferFragment&), (override));
   MOCK_METHOD(void, add, (absl::string_view), (override));
   MOCK_METHOD(void, add, (const Instance&), (override));
+  MOCK_METHOD(size_t, addFragments, (absl::Span<const absl::string_view>), (override));
   MOCK_METHOD(void, prepend, (absl::string_view), (override));
   MOCK_METHOD(void, prepend, (Instance&), (override));
   MOCK_METHOD(void, copyOut, (size_t, uint64_t, void*), (const, override));
@@ -180,6 +180,15 @@ public:
    */
   virtual void add(const Instance& data) PURE;
 
+  /**
+   * Copy a sequence of strings into the buffer. The total size is computed up front so that the
+   * fragments can be copied into a single reservation when possible, which is cheaper than
+   * calling add() for each of them.
+   * @param fragments supplies the strings to copy, in order.
+   * @return the number of bytes added.
+   */
+  virtual size_t addFragments(absl::Span<const absl::string_view> fragments) PURE;
+
   /**
    * Prepend a string_view to the buffer.
    * @param data supplies the string_view to copy.
@@ -257,6 +257,50 @@ public:
  */
 using FilterFactoryCb = std::function<void(FilterManager& filter_manager)>;
 
+/**
+ * Data peeked from the front of an accepted socket. It is shared by all of the listener filters of
+ * a connection, so a filter that runs after another one does not need to peek at the socket again
+ * to see the same data.
+ */
+class ListenerFilterBuffer {
+public:
+  virtual ~ListenerFilterBuffer() = default;
+
+  /**
+   * Peek at up to max_length bytes from the front of the socket without consuming them. The
+   * socket is only peeked at again when it may hold data that the previous peek did not return:
+   * after onSocketReadable() has been called, or when the previous peek was truncated at fewer
+   * than max_length bytes. Otherwise the previously peeked data is returned.
+   * @param max_length supplies the maximum number of bytes to peek at.
+   * @return the result of the peek. On success, the return value is the number of bytes at the
+   *         front of peekedData() that can be inspected, which is at most max_length. A return
+   *         value of 0 means that the remote closed the connection.
+   */
+  virtual Api::IoCallUint64Result peek(uint64_t max_length) PURE;
+
+  /**
+   * @return the data returned by the last successful peek, less any data consumed with read().
+   *         The view is invalidated by the next call to peek() or read().
+   */
+  virtual absl::string_view peekedData() const PURE;
+
+  /**
+   * Consume up to length bytes from the front of the socket into the given buffer. Listener
+   * filters must consume data through this method rather than the socket's IoHandle so that the
+   * peeked data stays consistent with the socket.
+   * @param buffer supplies the buffer to read into.
+   * @param length supplies the maximum number of bytes to read.
+   * @return the result of the read.
+   */
+  virtual Api::IoCallUint64Result read(void* buffer, uint64_t length) PURE;
+
+  /**
+   * Signal that the socket has become readable, so the next peek() must look at the socket again.
+   * Listener filters call this from the file event callbacks they register on the socket.
+   */
+  virtual void onSocketReadable() PURE;
+};
+
 /**
  * Callbacks used by individual listener filter instances to communicate with the listener filter
  * manager.
@@ -303,6 +347,12 @@ public:
    * @return Object on which filters can share data on a per-request basis.
    */
   virtual StreamInfo::FilterState& filterState() PURE;
+
+  /**
+   * @return ListenerFilterBuffer& the data peeked from the socket, shared by all of the listener
+   *         filters of the connection.
+   */
+  virtual ListenerFilterBuffer& listenerFilterBuffer() PURE;
 };
 
 /**
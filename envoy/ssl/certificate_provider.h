@@ -0,0 +1,94 @@
+#pragma once
+
+#include <memory>
+
+#include "envoy/common/pure.h"
+#include "envoy/event/dispatcher.h"
+
+#include "absl/strings/string_view.h"
+#include "openssl/ssl.h"
+
+namespace Envoy {
+namespace Ssl {
+
+/**
+ * A server certificate produced at handshake time by a CertificateProvider.
+ */
+struct ProvidedCertificate {
+  // The leaf certificate.
+  bssl::UniquePtr<X509> cert_chain_;
+  // The intermediate certificates sent after the leaf, may be null.
+  bssl::UniquePtr<STACK_OF(X509)> intermediates_;
+  bssl::UniquePtr<EVP_PKEY> private_key_;
+};
+
+using ProvidedCertificateConstSharedPtr = std::shared_ptr<const ProvidedCertificate>;
+
+/**
+ * Callbacks for an asynchronous certificate fetch.
+ */
+class CertificateProviderCallbacks {
+public:
+  virtual ~CertificateProviderCallbacks() = default;
+
+  /**
+   * Called when a fetch started by CertificateProvider::fetchCertificate() completes.
+   * @param certificate supplies the certificate for the requested server name, or nullptr if the
+   *        provider has none, in which case the statically configured certificates are used.
+   */
+  virtual void onCertificateFetchComplete(ProvidedCertificateConstSharedPtr certificate) PURE;
+};
+
+/**
+ * An in-flight certificate fetch.
+ */
+class CertificateFetch {
+public:
+  virtual ~CertificateFetch() = default;
+
+  /**
+   * Cancel the fetch. The callbacks will not be invoked after this returns.
+   */
+  virtual void cancel() PURE;
+};
+
+/**
+ * Supplies server certificates by SNI when the handshake reaches certificate selection, so that
+ * certificates do not have to be loaded when the TLS context is built.
+ */
+class CertificateProvider {
+public:
+  virtual ~CertificateProvider() = default;
+
+  /**
+   * Start fetching the certificate for a server name.
+   * @param server_name supplies the lower-cased SNI sent by the client.
+   * @param dispatcher supplies the dispatcher of the connection's worker thread.
+   * @param callbacks supplies the callbacks to invoke on completion. They must be invoked on
+   *        the given dispatcher and never from within this call.
+   * @return CertificateFetch* a handle that can be used to cancel the fetch. It is owned by the
+   *         provider and remains valid until the callbacks are invoked or it is cancelled.
+   */
+  virtual CertificateFetch* fetchCertificate(absl::string_view server_name,
+                                             Event::Dispatcher& dispatcher,
+                                             CertificateProviderCallbacks& callbacks) PURE;
+};
+
+using CertificateProviderSharedPtr = std::shared_ptr<CertificateProvider>;
+
+/**
+ * Connection callbacks for resuming a handshake suspended on certificate selection.
+ */
+class CertificateSelectionCallbacks {
+public:
+  virtual ~CertificateSelectionCallbacks() = default;
+
+  /**
+   * Called when the certificate for the connection has been selected. The selection is
+   * applied when SSL_do_handshake() is called the next time.
+   */
+  virtual void onCertificateSelectionComplete() PURE;
+};
+
+} // namespace Ssl
+} // namespace Envoy
@@ -7,6 +7,7 @@
 #include <vector>
 
 #include "envoy/common/pure.h"
+#include "envoy/ssl/certificate_provider.h"
 #include "envoy/ssl/certificate_validation_context_config.h"
 #include "envoy/ssl/handshaker.h"
 #include "envoy/ssl/tls_certificate_config.h"
@@ -162,6 +163,24 @@ public:
    * @return True if stateless TLS session resumption is disabled, false otherwise.
    */
   virtual bool disableStatelessSessionResumption() const PURE;
+
+  /**
+   * @return the provider consulted for the certificate of each SNI at handshake time, or nullptr
+   * if only the statically configured certificates are served.
+   */
+  virtual CertificateProviderSharedPtr certificateProvider() const PURE;
+
+  /**
+   * @return the maximum number of provided certificates kept in memory for reuse by later
+   * handshakes.
+   */
+  virtual uint32_t maxCachedProvidedCertificates() const PURE;
+
+  /**
+   * @return how long the absence of a certificate for a server name, as reported by the
+   * certificate provider, is cached before the provider is asked again.
+   */
+  virtual std::chrono::milliseconds providedCertificateNegativeCacheTtl() const PURE;
 };
 
 using ServerContextConfigPtr = std::unique_ptr<ServerContextConfig>;
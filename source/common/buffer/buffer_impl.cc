@@ -64,6 +64,32 @@ void OwnedImpl::add(const Instance& data) {
   }
 }
 
+size_t OwnedImpl::addFragments(absl::Span<const absl::string_view> fragments) {
+  size_t total_size = 0;
+  for (const absl::string_view& fragment : fragments) {
+    total_size += fragment.size();
+  }
+  if (total_size == 0) {
+    return 0;
+  }
+  if (slices_.empty()) {
+    slices_.emplace_back(Slice(total_size, account_));
+  }
+
+  Slice& back = slices_.back();
+  if (back.reservableSize() >= total_size) {
+    for (const absl::string_view& fragment : fragments) {
+      back.append(fragment.data(), fragment.size());
+    }
+    length_ += total_size;
+  } else {
+    for (const absl::string_view& fragment : fragments) {
+      addImpl(fragment.data(), fragment.size());
+    }
+  }
+  return total_size;
+}
+
 void OwnedImpl::prepend(absl::string_view data) {
   uint64_t size = data.size();
   bool new_slice_needed = slices_.empty();
@@ -678,6 +678,7 @@ public:
   void addBufferFragment(BufferFragment& fragment) override;
   void add(absl::string_view data) override;
   void add(const Instance& data) override;
+  size_t addFragments(absl::Span<const absl::string_view> fragments) override;
   void prepend(absl::string_view data) override;
   void prepend(Instance& data) override;
   void copyOut(size_t start, uint64_t size, void* data) const override;
@@ -36,6 +36,12 @@ void WatermarkBuffer::add(const Instance& data) {
   checkHighAndOverflowWatermarks();
 }
 
+size_t WatermarkBuffer::addFragments(absl::Span<const absl::string_view> fragments) {
+  const size_t total_size = OwnedImpl::addFragments(fragments);
+  checkHighAndOverflowWatermarks();
+  return total_size;
+}
+
 void WatermarkBuffer::prepend(absl::string_view data) {
   OwnedImpl::prepend(data);
   checkHighAndOverflowWatermarks();
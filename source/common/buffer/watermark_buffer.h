@@ -32,6 +32,7 @@ public:
   void add(const void* data, uint64_t size) override;
   void add(absl::string_view data) override;
   void add(const Instance& data) override;
+  size_t addFragments(absl::Span<const absl::string_view> fragments) override;
   void prepend(absl::string_view data) override;
   void prepend(Instance& data) override;
   void drain(uint64_t size) override;
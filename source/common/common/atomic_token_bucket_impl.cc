@@ -0,0 +1,84 @@
+#include "source/common/common/atomic_token_bucket_impl.h"
+
+#include <chrono>
+#include <cmath>
+
+#include "source/common/common/assert.h"
+
+namespace Envoy {
+
+namespace {
+
+// Tokens are derived from floating point times, so a whole number of tokens may be computed as
+// slightly less than that number. This tolerance keeps such tokens from being lost to rounding.
+constexpr double TokenTolerance = 1e-6;
+
+} // namespace
+
+AtomicTokenBucketImpl::AtomicTokenBucketImpl(uint64_t max_tokens, TimeSource& time_source,
+                                             double fill_rate)
+    : max_tokens_(max_tokens), fill_rate_(std::abs(fill_rate)), time_source_(time_source),
+      empty_time_in_seconds_(timeNowInSeconds() - (fill_rate_ > 0 ? max_tokens_ / fill_rate_ : 0)) {
+}
+
+double AtomicTokenBucketImpl::timeNowInSeconds() const {
+  return std::chrono::duration<double>(time_source_.monotonicTime().time_since_epoch()).count();
+}
+
+double AtomicTokenBucketImpl::tokensAt(double time_now, double empty_time) const {
+  if (fill_rate_ == 0) {
+    return 0;
+  }
+  // Another thread may have moved the empty time past a time_now read before it did so.
+  return std::max(0.0, std::min(max_tokens_, (time_now - empty_time) * fill_rate_));
+}
+
+uint64_t AtomicTokenBucketImpl::consume(uint64_t tokens, bool allow_partial) {
+  const double time_now = timeNowInSeconds();
+  double empty_time = empty_time_in_seconds_.load(std::memory_order_relaxed);
+  uint64_t tokens_consumed;
+  double new_empty_time;
+  do {
+    const double tokens_available = tokensAt(time_now, empty_time);
+    const uint64_t whole_tokens_available =
+        static_cast<uint64_t>(std::floor(tokens_available + TokenTolerance));
+    tokens_consumed = allow_partial ? std::min(tokens, whole_tokens_available) : tokens;
+    if (tokens_consumed == 0 || whole_tokens_available < tokens_consumed) {
+      return 0;
+    }
+    // Move the empty time forward so that the bucket holds the remaining tokens at time_now. This
+    // also discards any tokens that would have overflowed the bucket.
+    new_empty_time = time_now - std::max(0.0, tokens_available - tokens_consumed) / fill_rate_;
+  } while (!empty_time_in_seconds_.compare_exchange_weak(empty_time, new_empty_time));
+
+  return tokens_consumed;
+}
+
+uint64_t AtomicTokenBucketImpl::consume(uint64_t tokens, bool allow_partial,
+                                        std::chrono::milliseconds& time_to_next_token) {
+  const uint64_t tokens_consumed = consume(tokens, allow_partial);
+  time_to_next_token = nextTokenAvailable();
+  return tokens_consumed;
+}
+
+std::chrono::milliseconds AtomicTokenBucketImpl::nextTokenAvailable() {
+  // If there are tokens available, return immediately.
+  const double tokens_available =
+      tokensAt(timeNowInSeconds(), empty_time_in_seconds_.load(std::memory_order_relaxed));
+  if (tokens_available + TokenTolerance >= 1) {
+    return std::chrono::milliseconds(0);
+  }
+  return std::chrono::milliseconds(static_cast<uint64_t>(std::ceil((1 / fill_rate_) * 1000)));
+}
+
+void AtomicTokenBucketImpl::maybeReset(uint64_t num_tokens) {
+  ASSERT(num_tokens <= max_tokens_);
+  // Don't reset if reset once before.
+  if (reset_once_.exchange(true)) {
+    return;
+  }
+  empty_time_in_seconds_ =
+      timeNowInSeconds() - (fill_rate_ > 0 ? static_cast<double>(num_tokens) / fill_rate_ : 0);
+}
+
+} // namespace Envoy
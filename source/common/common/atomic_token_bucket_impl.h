@@ -0,0 +1,56 @@
+#pragma once
+
+#include <atomic>
+
+#include "envoy/common/time.h"
+#include "envoy/common/token_bucket.h"
+
+namespace Envoy {
+
+/**
+ * A lock-free, thread-safe implementation of the TokenBucket interface. Instead of tracking a token
+ * count that is refilled on access, the bucket stores the time at which it would have been empty.
+ * The current number of tokens is derived from the time elapsed since then, and tokens are consumed
+ * by moving that time forward with a compare-and-swap. Threads sharing the bucket never block each
+ * other, and tokens are replenished continuously rather than in bursts.
+ */
+class AtomicTokenBucketImpl : public TokenBucket {
+public:
+  /**
+   * @param max_tokens supplies the maximum number of tokens in the bucket.
+   * @param time_source supplies the time source.
+   * @param fill_rate supplies the number of tokens that will return to the bucket on each second.
+   * The default is 1.
+   */
+  explicit AtomicTokenBucketImpl(uint64_t max_tokens, TimeSource& time_source,
+                                 double fill_rate = 1);
+
+  AtomicTokenBucketImpl(const AtomicTokenBucketImpl&) = delete;
+  AtomicTokenBucketImpl(AtomicTokenBucketImpl&&) = delete;
+
+  // TokenBucket
+  uint64_t consume(uint64_t tokens, bool allow_partial) override;
+  uint64_t consume(uint64_t tokens, bool allow_partial,
+                   std::chrono::milliseconds& time_to_next_token) override;
+  std::chrono::milliseconds nextTokenAvailable() override;
+
+  /**
+   * Since the token bucket is shared, only the first reset call will work.
+   * Subsequent calls to reset method will be ignored.
+   */
+  void maybeReset(uint64_t num_tokens) override;
+
+private:
+  double timeNowInSeconds() const;
+  double tokensAt(double time_now, double empty_time) const;
+
+  const double max_tokens_;
+  const double fill_rate_;
+  TimeSource& time_source_;
+  // The time, in seconds, at which the bucket would have been empty given the tokens consumed so
+  // far. The bucket holds (now - empty_time_in_seconds_) * fill_rate_ tokens, up to max_tokens_.
+  std::atomic<double> empty_time_in_seconds_;
+  std::atomic<bool> reset_once_{false};
+};
+
+} // namespace Envoy
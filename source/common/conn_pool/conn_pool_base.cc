@@ -10,6 +10,10 @@
 namespace Envoy {
 namespace ConnectionPool {
 namespace {
+// The minimum time an idle connection must have been established for before it is replaced when
+// the upstream closes it.
+constexpr std::chrono::seconds MinIdleLifetimeForReplacement{1};
+
 [[maybe_unused]] ssize_t connectingCapacity(const std::list<ActiveClientPtr>& connecting_clients) {
   ssize_t ret = 0;
   for (const auto& client : connecting_clients) {
@@ -424,6 +428,15 @@ void ConnPoolImplBase::checkForIdleAndCloseIdleConnsIfDraining() {
 
 void ConnPoolImplBase::onConnectionEvent(ActiveClient& client, absl::string_view failure_reason,
                                          Network::ConnectionEvent event) {
+  // Whether the upstream closed a connection that was sitting idle, e.g. a preconnected one. Some
+  // upstreams close idle connections right after accepting them, so only connections that lived
+  // for a while are replaced, which bounds how often a connection slot is reconnected.
+  const bool idle_client_remote_close =
+      event == Network::ConnectionEvent::RemoteClose &&
+      client.state() == ActiveClient::State::READY && client.numActiveStreams() == 0 &&
+      dispatcher_.timeSource().monotonicTime() - client.connected_time_ >=
+          MinIdleLifetimeForReplacement;
+
   if (client.state() == ActiveClient::State::CONNECTING) {
     ASSERT(connecting_stream_capacity_ >= client.effectiveConcurrentStreamLimit());
     connecting_stream_capacity_ -= client.effectiveConcurrentStreamLimit();
@@ -502,13 +515,16 @@ void ConnPoolImplBase::onConnectionEvent(ActiveClient& client, absl::string_view
 
     client.setState(ActiveClient::State::CLOSED);
 
-    // If we have pending streams and we just lost a connection we should make a new one.
-    if (!pending_streams_.empty()) {
+    // If we have pending streams and we just lost a connection we should make a new one. Likewise,
+    // if the upstream closed an idle connection, replace it when preconnecting calls for it so that
+    // the next stream does not have to wait for a connection to be established.
+    if (!pending_streams_.empty() || (idle_client_remote_close && !is_draining_for_deletion_)) {
       tryCreateNewConnections();
     }
   } else if (event == Network::ConnectionEvent::Connected) {
     client.conn_connect_ms_->complete();
     client.conn_connect_ms_.reset();
+    client.connected_time_ = dispatcher_.timeSource().monotonicTime();
     ASSERT(client.state() == ActiveClient::State::CONNECTING);
     bool streams_available = client.currentUnusedCapacity() > 0;
     transitionActiveClientState(client, streams_available ? ActiveClient::State::READY
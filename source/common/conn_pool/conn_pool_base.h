@@ -115,6 +115,9 @@ public:
   Stats::TimespanPtr conn_length_;
   Event::TimerPtr connect_timer_;
   Event::TimerPtr connection_duration_timer_;
+  // When the connection was established, used to tell apart connections the upstream closes right
+  // away from ones that were idle for a while.
+  MonotonicTime connected_time_;
   bool resources_released_{false};
   bool timed_out_{false};
 
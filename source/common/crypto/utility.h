@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <memory>
 #include <vector>
 
 #include "envoy/buffer/buffer.h"
@@ -27,6 +28,28 @@ struct VerificationOutput {
   std::string error_message_;
 };
 
+/**
+ * Computes a SHA-256 digest incrementally, for data that is not available all at once.
+ */
+class Sha256Hasher {
+public:
+  virtual ~Sha256Hasher() = default;
+
+  /**
+   * Adds the contents of a buffer to the digest.
+   * @param buffer the buffer.
+   */
+  virtual void update(const Buffer::Instance& buffer) PURE;
+
+  /**
+   * Completes the digest. The hasher may not be updated afterwards.
+   * @return a vector of bytes for the computed digest.
+   */
+  virtual std::vector<uint8_t> finish() PURE;
+};
+
+using Sha256HasherPtr = std::unique_ptr<Sha256Hasher>;
+
 class Utility {
 public:
   virtual ~Utility() = default;
@@ -38,6 +61,12 @@ public:
    */
   virtual std::vector<uint8_t> getSha256Digest(const Buffer::Instance& buffer) PURE;
 
+  /**
+   * Creates a hasher that computes a SHA-256 digest over data added to it in pieces.
+   * @return the hasher.
+   */
+  virtual Sha256HasherPtr createSha256Hasher() PURE;
+
   /**
    * Computes the SHA-256 HMAC for a given key and message.
    * @param key the HMAC function key.
@@ -11,20 +11,33 @@ namespace Envoy {
 namespace Common {
 namespace Crypto {
 
-std::vector<uint8_t> UtilityImpl::getSha256Digest(const Buffer::Instance& buffer) {
-  std::vector<uint8_t> digest(SHA256_DIGEST_LENGTH);
-  bssl::ScopedEVP_MD_CTX ctx;
-  auto rc = EVP_DigestInit(ctx.get(), EVP_sha256());
+Sha256HasherImpl::Sha256HasherImpl() {
+  const auto rc = EVP_DigestInit(ctx_.get(), EVP_sha256());
   RELEASE_ASSERT(rc == 1, "Failed to init digest context");
+}
+
+void Sha256HasherImpl::update(const Buffer::Instance& buffer) {
   for (const auto& slice : buffer.getRawSlices()) {
-    rc = EVP_DigestUpdate(ctx.get(), slice.mem_, slice.len_);
+    const auto rc = EVP_DigestUpdate(ctx_.get(), slice.mem_, slice.len_);
     RELEASE_ASSERT(rc == 1, "Failed to update digest");
   }
-  rc = EVP_DigestFinal(ctx.get(), digest.data(), nullptr);
+}
+
+std::vector<uint8_t> Sha256HasherImpl::finish() {
+  std::vector<uint8_t> digest(SHA256_DIGEST_LENGTH);
+  const auto rc = EVP_DigestFinal(ctx_.get(), digest.data(), nullptr);
   RELEASE_ASSERT(rc == 1, "Failed to finalize digest");
   return digest;
 }
 
+std::vector<uint8_t> UtilityImpl::getSha256Digest(const Buffer::Instance& buffer) {
+  Sha256HasherImpl hasher;
+  hasher.update(buffer);
+  return hasher.finish();
+}
+
+Sha256HasherPtr UtilityImpl::createSha256Hasher() { return std::make_unique<Sha256HasherImpl>(); }
+
 std::vector<uint8_t> UtilityImpl::getSha256Hmac(const std::vector<uint8_t>& key,
                                                 absl::string_view message) {
   std::vector<uint8_t> hmac(SHA256_DIGEST_LENGTH);
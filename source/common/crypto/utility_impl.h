@@ -3,6 +3,7 @@
 #include "source/common/crypto/utility.h"
 
 #include "openssl/bytestring.h"
+#include "openssl/evp.h"
 #include "openssl/hmac.h"
 #include "openssl/sha.h"
 
@@ -10,9 +11,22 @@ namespace Envoy {
 namespace Common {
 namespace Crypto {
 
+class Sha256HasherImpl : public Sha256Hasher {
+public:
+  Sha256HasherImpl();
+
+  // Sha256Hasher
+  void update(const Buffer::Instance& buffer) override;
+  std::vector<uint8_t> finish() override;
+
+private:
+  bssl::ScopedEVP_MD_CTX ctx_;
+};
+
 class UtilityImpl : public Envoy::Common::Crypto::Utility {
 public:
   std::vector<uint8_t> getSha256Digest(const Buffer::Instance& buffer) override;
+  Sha256HasherPtr createSha256Hasher() override;
   std::vector<uint8_t> getSha256Hmac(const std::vector<uint8_t>& key,
                                      absl::string_view message) override;
   const VerificationOutput verifySignature(absl::string_view hash, CryptoObject& key,
@@ -2,7 +2,6 @@
 
 #include "source/common/common/assert.h"
 #include "source/common/event/schedulable_cb_impl.h"
-#include "source/common/event/timer_impl.h"
 
 #include "event2/util.h"
 
@@ -36,7 +35,7 @@ LibeventScheduler::LibeventScheduler() {
 }
 
 TimerPtr LibeventScheduler::createTimer(const TimerCb& cb, Dispatcher& dispatcher) {
-  return std::make_unique<TimerImpl>(libevent_, cb, dispatcher);
+  return std::make_unique<TimerImpl>(libevent_, cb, dispatcher, common_timeouts_);
 };
 
 SchedulableCallbackPtr
@@ -7,6 +7,7 @@
 #include "envoy/event/timer.h"
 
 #include "source/common/event/libevent.h"
+#include "source/common/event/timer_impl.h"
 
 #include "event2/event.h"
 #include "event2/watch.h"
@@ -115,6 +116,7 @@ private:
   }
 
   Libevent::BasePtr libevent_;
+  CommonTimeouts common_timeouts_{libevent_};
   DispatcherStats* stats_{}; // stats owned by the containing DispatcherImpl
   bool timeout_set_{};       // whether there is a poll timeout in the current event loop iteration
   timeval timeout_{};        // the poll timeout for the current event loop iteration, if available
@@ -9,8 +9,25 @@
 namespace Envoy {
 namespace Event {
 
-TimerImpl::TimerImpl(Libevent::BasePtr& libevent, TimerCb cb, Dispatcher& dispatcher)
-    : cb_(cb), dispatcher_(dispatcher) {
+const timeval* CommonTimeouts::get(const timeval& tv) {
+  if (tv.tv_usec != 0 || tv.tv_sec == 0) {
+    return nullptr;
+  }
+  auto it = timeouts_.find(tv.tv_sec);
+  if (it != timeouts_.end()) {
+    return it->second;
+  }
+  if (timeouts_.size() >= MaxCommonTimeouts) {
+    return nullptr;
+  }
+  const timeval* common_tv = event_base_init_common_timeout(libevent_.get(), &tv);
+  timeouts_.emplace(tv.tv_sec, common_tv);
+  return common_tv;
+}
+
+TimerImpl::TimerImpl(Libevent::BasePtr& libevent, TimerCb cb, Dispatcher& dispatcher,
+                     CommonTimeouts& common_timeouts)
+    : cb_(cb), dispatcher_(dispatcher), common_timeouts_(common_timeouts) {
   ASSERT(cb_);
   evtimer_assign(
       &raw_event_, libevent.get(),
@@ -49,7 +66,8 @@ void TimerImpl::internalEnableTimer(const timeval& tv, const ScopeTrackedObject*
   ASSERT(dispatcher_.isThreadSafe());
   object_ = object;
 
-  event_add(&raw_event_, &tv);
+  const timeval* common_tv = common_timeouts_.get(tv);
+  event_add(&raw_event_, common_tv != nullptr ? common_tv : &tv);
 }
 
 bool TimerImpl::enabled() {
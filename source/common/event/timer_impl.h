@@ -9,6 +9,8 @@
 #include "source/common/event/event_impl_base.h"
 #include "source/common/event/libevent.h"
 
+#include "absl/container/flat_hash_map.h"
+
 namespace Envoy {
 namespace Event {
 
@@ -47,12 +49,41 @@ public:
   }
 };
 
+/**
+ * Per event_base registry of libevent "common timeouts". libevent keeps events armed with a
+ * common timeout in a FIFO queue per duration rather than in its min-heap, so arming and disarming
+ * them is O(1) instead of O(log n). This is a good fit for the many per-connection and per-stream
+ * timers (idle timeouts, stream timeouts, ...) that are re-armed with the same configured duration.
+ * libevent supports a bounded number of common timeouts per base, so only whole-second durations
+ * are registered, which keeps jittered timers from exhausting the available queues. Everything
+ * else falls back to the min-heap.
+ */
+class CommonTimeouts {
+public:
+  // Leaves headroom below libevent's MAX_COMMON_TIMEOUTS (256).
+  static constexpr uint32_t MaxCommonTimeouts = 128;
+
+  explicit CommonTimeouts(Libevent::BasePtr& libevent) : libevent_(libevent) {}
+
+  /**
+   * @param tv supplies the relative timeout.
+   * @return the libevent common timeout equivalent to tv, or nullptr if tv should be armed on the
+   *         min-heap.
+   */
+  const timeval* get(const timeval& tv);
+
+private:
+  Libevent::BasePtr& libevent_;
+  absl::flat_hash_map<time_t, const timeval*> timeouts_;
+};
+
 /**
  * libevent implementation of Timer.
  */
 class TimerImpl : public Timer, ImplBase {
 public:
-  TimerImpl(Libevent::BasePtr& libevent, TimerCb cb, Event::Dispatcher& dispatcher);
+  TimerImpl(Libevent::BasePtr& libevent, TimerCb cb, Event::Dispatcher& dispatcher,
+            CommonTimeouts& common_timeouts);
 
   // Timer
   void disableTimer() override;
@@ -66,6 +97,7 @@ private:
   void internalEnableTimer(const timeval& tv, const ScopeTrackedObject* scope);
   TimerCb cb_;
   Dispatcher& dispatcher_;
+  CommonTimeouts& common_timeouts_;
   // This has to be atomic for alarms which are handled out of thread, for
   // example if the DispatcherImpl::post is called by two threads, they race to
   // both set this to null.
@@ -40,12 +40,32 @@ bool Decoder::decode(Buffer::Instance& input, std::vector<Frame>& output) {
   inspect(input);
   output_ = nullptr;
   if (decoding_error_) {
+    // The input is left unchanged on error, so copy the payloads of the frames decoded so far.
+    for (const PendingData& data : pending_data_) {
+      data.target_->add(data.mem_, data.length_);
+    }
+    pending_data_.clear();
     return false;
   }
+  moveFrameData(input);
   input.drain(input.length());
   return true;
 }
 
+void Decoder::moveFrameData(Buffer::Instance& input) {
+  // Payload runs are reported in input order and never overlap.
+  uint64_t consumed = 0;
+  for (const PendingData& data : pending_data_) {
+    ASSERT(data.offset_ >= consumed);
+    // Drop the frame header bytes preceding the payload, then move the payload itself. Moving
+    // hands whole slices over to the frame instead of copying them.
+    input.drain(data.offset_ - consumed);
+    data.target_->move(input, data.length_);
+    consumed = data.offset_ + data.length_;
+  }
+  pending_data_.clear();
+}
+
 bool Decoder::frameStart(uint8_t flags) {
   // Unsupported flags.
   if (flags & ~GRPC_FH_COMPRESSED) {
@@ -61,7 +81,9 @@ void Decoder::frameDataStart() {
   frame_.data_ = std::make_unique<Buffer::OwnedImpl>();
 }
 
-void Decoder::frameData(uint8_t* mem, uint64_t length) { frame_.data_->add(mem, length); }
+void Decoder::frameData(uint8_t* mem, uint64_t length) {
+  pending_data_.push_back({mem, data_offset_, length, frame_.data_.get()});
+}
 
 void Decoder::frameDataEnd() {
   output_->push_back(std::move(frame_));
@@ -72,6 +94,7 @@ void Decoder::frameDataEnd() {
 
 uint64_t FrameInspector::inspect(const Buffer::Instance& data) {
   uint64_t delta = 0;
+  uint64_t slice_offset = 0;
   for (const Buffer::RawSlice& slice : data.getRawSlices()) {
     uint8_t* mem = reinterpret_cast<uint8_t*>(slice.mem_);
     for (uint64_t j = 0; j < slice.len_;) {
@@ -119,6 +142,7 @@ uint64_t FrameInspector::inspect(const Buffer::Instance& data) {
         break;
       case State::Data:
         uint64_t remain_in_buffer = slice.len_ - j;
+        data_offset_ = slice_offset + j;
         if (remain_in_buffer <= length_) {
           frameData(mem, remain_in_buffer);
           mem += remain_in_buffer;
@@ -137,6 +161,7 @@ uint64_t FrameInspector::inspect(const Buffer::Instance& data) {
         break;
       }
     }
+    slice_offset += slice.len_;
   }
   return delta;
 }
@@ -105,6 +105,8 @@ protected:
   State state_{State::FhFlag};
   uint32_t length_{0};
   uint64_t count_{0};
+  // Offset in the buffer passed to inspect() of the memory passed to frameData().
+  uint64_t data_offset_{0};
 };
 
 class Decoder : public FrameInspector {
@@ -133,8 +135,20 @@ protected:
   void frameDataEnd() override;
 
 private:
+  // A run of frame payload bytes found by inspect(), to be moved into target_ once the whole
+  // input has been inspected.
+  struct PendingData {
+    const uint8_t* mem_;
+    uint64_t offset_;
+    uint64_t length_;
+    Buffer::Instance* target_;
+  };
+
+  void moveFrameData(Buffer::Instance& input);
+
   Frame frame_;
   std::vector<Frame>* output_{nullptr};
+  std::vector<PendingData> pending_data_;
   bool decoding_error_{false};
 };
 
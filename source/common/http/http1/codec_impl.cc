@@ -26,6 +26,7 @@
 
 #include "absl/container/fixed_array.h"
 #include "absl/strings/ascii.h"
+#include "absl/strings/str_cat.h"
 
 namespace Envoy {
 namespace Http {
@@ -81,6 +82,8 @@ StatefulHeaderKeyFormatterPtr statefulFormatterFromSettings(const Http::Http1Set
 }
 
 constexpr size_t CRLF_SIZE = 2;
+constexpr absl::string_view COLON_SPACE = ": ";
+constexpr absl::string_view SPACE = " ";
 
 } // namespace
 
@@ -105,13 +108,9 @@ void StreamEncoderImpl::encodeHeader(const char* key, uint32_t key_size, const c
                                      uint32_t value_size) {
 
   ASSERT(key_size > 0);
-  const uint64_t old_buffer_length = connection_.buffer().length();
-  connection_.copyToBuffer(key, key_size);
-  connection_.addCharToBuffer(':');
-  connection_.addCharToBuffer(' ');
-  connection_.copyToBuffer(value, value_size);
-  connection_.addToBuffer(CRLF);
-  bytes_meter_->addHeaderBytesSent(connection_.buffer().length() - old_buffer_length);
+  const uint64_t header_size = connection_.buffer().addFragments(
+      {absl::string_view(key, key_size), COLON_SPACE, absl::string_view(value, value_size), CRLF});
+  bytes_meter_->addHeaderBytesSent(header_size);
 }
 void StreamEncoderImpl::encodeHeader(absl::string_view key, absl::string_view value) {
   this->encodeHeader(key.data(), key.size(), value.data(), value.size());
@@ -245,8 +244,8 @@ void StreamEncoderImpl::encodeData(Buffer::Instance& data, bool end_stream) {
   // actually write the zero length buffer out.
   if (data.length() > 0) {
     if (chunk_encoding_) {
-      std::string chunk_header = absl::StrCat(absl::Hex(data.length()), CRLF);
-      connection_.buffer().add(std::move(chunk_header));
+      const absl::AlphaNum chunk_size(absl::Hex(data.length()));
+      connection_.buffer().addFragments({chunk_size.Piece(), CRLF});
     }
 
     connection_.buffer().move(data);
@@ -351,14 +350,6 @@ uint64_t ConnectionImpl::flushOutput(bool end_encode) {
 
 void ConnectionImpl::addToBuffer(absl::string_view data) { output_buffer_->add(data); }
 
-void ConnectionImpl::addCharToBuffer(char c) { output_buffer_->add(&c, 1); }
-
-void ConnectionImpl::addIntToBuffer(uint64_t i) { output_buffer_->add(absl::StrCat(i)); }
-
-void ConnectionImpl::copyToBuffer(const char* data, uint64_t length) {
-  output_buffer_->add(data, length);
-}
-
 void StreamEncoderImpl::resetStream(StreamResetReason reason) {
   connection_.onResetStreamBase(reason);
 }
@@ -396,8 +387,8 @@ const Network::Address::InstanceConstSharedPtr& StreamEncoderImpl::connectionLoc
   return connection_.connection().connectionInfoProvider().localAddress();
 }
 
-static const char RESPONSE_PREFIX[] = "HTTP/1.1 ";
-static const char HTTP_10_RESPONSE_PREFIX[] = "HTTP/1.0 ";
+static constexpr absl::string_view RESPONSE_PREFIX = "HTTP/1.1 ";
+static constexpr absl::string_view HTTP_10_RESPONSE_PREFIX = "HTTP/1.0 ";
 
 void ResponseEncoderImpl::encodeHeaders(const ResponseHeaderMap& headers, bool end_stream) {
   started_response_ = true;
@@ -406,26 +397,24 @@ void ResponseEncoderImpl::encodeHeaders(const ResponseHeaderMap& headers, bool e
   ASSERT(headers.Status() != nullptr);
   uint64_t numeric_status = Utility::getResponseStatus(headers);
 
-  if (connection_.protocol() == Protocol::Http10 && connection_.supportsHttp10()) {
-    connection_.copyToBuffer(HTTP_10_RESPONSE_PREFIX, sizeof(HTTP_10_RESPONSE_PREFIX) - 1);
-  } else {
-    connection_.copyToBuffer(RESPONSE_PREFIX, sizeof(RESPONSE_PREFIX) - 1);
-  }
-  connection_.addIntToBuffer(numeric_status);
-  connection_.addCharToBuffer(' ');
+  const absl::string_view response_prefix =
+      connection_.protocol() == Protocol::Http10 && connection_.supportsHttp10()
+          ? HTTP_10_RESPONSE_PREFIX
+          : RESPONSE_PREFIX;
+  const absl::AlphaNum status_code(numeric_status);
 
   StatefulHeaderKeyFormatterOptConstRef formatter(headers.formatter());
 
+  absl::string_view reason_phrase;
   if (formatter.has_value() && !formatter->getReasonPhrase().empty()) {
-    connection_.addToBuffer(formatter->getReasonPhrase());
+    reason_phrase = formatter->getReasonPhrase();
   } else {
-    const char* status_string = CodeUtility::toString(static_cast<Code>(numeric_status));
-    uint32_t status_string_len = strlen(status_string);
-    connection_.copyToBuffer(status_string, status_string_len);
+    reason_phrase = CodeUtility::toString(static_cast<Code>(numeric_status));
   }
 
-  connection_.addCharToBuffer('\r');
-  connection_.addCharToBuffer('\n');
+  // Write the whole status line with a single copy into the output buffer.
+  connection_.buffer().addFragments(
+      {response_prefix, status_code.Piece(), SPACE, reason_phrase, CRLF});
 
   if (numeric_status >= 300) {
     // Don't do special CONNECT logic if the CONNECT was rejected.
@@ -435,7 +424,7 @@ void ResponseEncoderImpl::encodeHeaders(const ResponseHeaderMap& headers, bool e
   encodeHeadersBase(headers, absl::make_optional<uint64_t>(numeric_status), end_stream, false);
 }
 
-static const char REQUEST_POSTFIX[] = " HTTP/1.1\r\n";
+static constexpr absl::string_view REQUEST_POSTFIX = " HTTP/1.1\r\n";
 
 Status RequestEncoderImpl::encodeHeaders(const RequestHeaderMap& headers, bool end_stream) {
   // Required headers must be present. This can only happen by some erroneous processing after the
@@ -459,14 +448,10 @@ Status RequestEncoderImpl::encodeHeaders(const RequestHeaderMap& headers, bool e
     upgrade_request_ = true;
   }
 
-  connection_.copyToBuffer(method->value().getStringView().data(), method->value().size());
-  connection_.addCharToBuffer(' ');
-  if (is_connect) {
-    connection_.copyToBuffer(host->value().getStringView().data(), host->value().size());
-  } else {
-    connection_.copyToBuffer(path->value().getStringView().data(), path->value().size());
-  }
-  connection_.copyToBuffer(REQUEST_POSTFIX, sizeof(REQUEST_POSTFIX) - 1);
+  connection_.buffer().addFragments({method->value().getStringView(), SPACE,
+                                     is_connect ? host->value().getStringView()
+                                                : path->value().getStringView(),
+                                     REQUEST_POSTFIX});
 
   encodeHeadersBase(headers, absl::nullopt, end_stream,
                     HeaderUtility::requestShouldHaveNoBody(headers));
@@ -232,11 +232,8 @@ public:
   uint64_t flushOutput(bool end_encode = false);
 
   void addToBuffer(absl::string_view data);
-  void addCharToBuffer(char c);
-  void addIntToBuffer(uint64_t i);
   Buffer::Instance& buffer() { return *output_buffer_; }
   uint64_t bufferRemainingSize();
-  void copyToBuffer(const char* data, uint64_t length);
   void reserveBuffer(uint64_t size);
   void readDisable(bool disable) {
     if (connection_.state() == Network::Connection::State::Open) {
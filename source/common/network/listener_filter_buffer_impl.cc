@@ -0,0 +1,65 @@
+#include "source/common/network/listener_filter_buffer_impl.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "envoy/common/platform.h"
+
+namespace Envoy {
+namespace Network {
+
+namespace {
+
+// Returns scratch space of at least the given size for the calling thread. Peeks are made into it
+// and only the bytes that were peeked are copied to the buffer of the connection, so connections
+// do not each hold storage for the largest peek that their listener filters may request.
+uint8_t* peekScratchBuffer(uint64_t size) {
+  static thread_local std::vector<uint8_t> scratch_buffer;
+  if (scratch_buffer.size() < size) {
+    scratch_buffer.resize(size);
+  }
+  return scratch_buffer.data();
+}
+
+} // namespace
+
+Api::IoCallUint64Result ListenerFilterBufferImpl::peek(uint64_t max_length) {
+  // Nothing new can be seen on the socket unless it became readable since the last peek, or the
+  // last peek stopped short of data that was already waiting.
+  if (!readable_ && length_ > 0 && (complete_ || length_ >= max_length)) {
+    Api::IoCallUint64Result result = Api::ioCallUint64ResultNoError();
+    result.return_value_ = std::min(length_, max_length);
+    return result;
+  }
+
+  offset_ = 0;
+  length_ = 0;
+  uint8_t* scratch_buffer = peekScratchBuffer(max_length);
+  auto result = io_handle_.recv(scratch_buffer, max_length, MSG_PEEK);
+  if (!result.ok()) {
+    return result;
+  }
+  length_ = result.return_value_;
+  if (length_ > capacity_) {
+    data_.reset(new uint8_t[length_]);
+    capacity_ = length_;
+  }
+  std::copy(scratch_buffer, scratch_buffer + length_, data_.get());
+  complete_ = length_ < max_length;
+  readable_ = false;
+  return result;
+}
+
+Api::IoCallUint64Result ListenerFilterBufferImpl::read(void* buffer, uint64_t length) {
+  auto result = io_handle_.recv(buffer, length, 0);
+  if (result.ok()) {
+    // The data read is the data at the front of what was peeked, if it was peeked at all.
+    const uint64_t consumed = std::min<uint64_t>(result.return_value_, length_);
+    offset_ += consumed;
+    length_ -= consumed;
+  }
+  return result;
+}
+
+} // namespace Network
+} // namespace Envoy
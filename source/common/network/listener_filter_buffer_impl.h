@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "envoy/network/filter.h"
+#include "envoy/network/io_handle.h"
+
+namespace Envoy {
+namespace Network {
+
+/**
+ * ListenerFilterBuffer implementation that peeks at the socket through its IoHandle. Peeks are made
+ * into per-thread scratch space, and the storage of the connection is only sized to the data that
+ * was actually peeked.
+ */
+class ListenerFilterBufferImpl : public ListenerFilterBuffer {
+public:
+  explicit ListenerFilterBufferImpl(IoHandle& io_handle) : io_handle_(io_handle) {}
+
+  // Network::ListenerFilterBuffer
+  Api::IoCallUint64Result peek(uint64_t max_length) override;
+  absl::string_view peekedData() const override {
+    return {reinterpret_cast<const char*>(data_.get()) + offset_, length_};
+  }
+  Api::IoCallUint64Result read(void* buffer, uint64_t length) override;
+  void onSocketReadable() override { readable_ = true; }
+
+private:
+  IoHandle& io_handle_;
+  std::unique_ptr<uint8_t[]> data_;
+  uint64_t capacity_{};
+  // The peeked data starts at offset_ in data_, after the data consumed with read().
+  uint64_t offset_{};
+  uint64_t length_{};
+  // Whether the last peek returned all of the data that was waiting on the socket.
+  bool complete_{};
+  // Whether the socket may have received data since the last peek.
+  bool readable_{true};
+};
+
+} // namespace Network
+} // namespace Envoy
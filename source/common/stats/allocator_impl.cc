@@ -90,17 +90,23 @@ public:
   // RefcountInterface
   void incRefCount() override { ++ref_count_; }
   bool decRefCount() override {
+    // A decrement that cannot reach zero does not need the allocator's lock:
+    // no other thread can destruct the stat while we still hold a reference,
+    // and a concurrent makeCounter()/makeGauge() only increments. This matters
+    // at flush time, where the metrics snapshot takes and releases a reference
+    // to every sinked stat.
+    uint32_t count = ref_count_.load();
+    while (count > 1) {
+      if (ref_count_.compare_exchange_weak(count, count - 1)) {
+        return false;
+      }
+    }
+
     // We must, unfortunately, hold the allocator's lock when decrementing the
-    // refcount. Otherwise another thread may simultaneously try to allocate the
-    // same name'd stat after we decrement it, and we'll wind up with a
-    // dtor/update race. To avoid this we must hold the lock until the stat is
-    // removed from the map.
-    //
-    // It might be worth thinking about a race-free way to decrement ref-counts
-    // without a lock, for the case where ref_count > 2, and we don't need to
-    // destruct anything. But it seems preferable at to be conservative here,
-    // as stats will only go out of scope when a scope is destructed (during
-    // xDS) or during admin stats operations.
+    // refcount to zero. Otherwise another thread may simultaneously try to
+    // allocate the same name'd stat after we decrement it, and we'll wind up
+    // with a dtor/update race. To avoid this we must hold the lock until the
+    // stat is removed from the map.
     Thread::LockGuard lock(alloc_.mutex_);
     ASSERT(ref_count_ >= 1);
     if (--ref_count_ == 0) {
@@ -128,9 +134,10 @@ protected:
   // but these are always in transition to ref-count 2 or higher, and thus
   // cannot race with a decrement to zero.
   //
-  // However, we must hold alloc_.mutex_ when decrementing ref_count_ so that
-  // when it hits zero we can atomically remove it from alloc_.counters_ or
-  // alloc_.gauges_. We leave it atomic to avoid taking the lock on increment.
+  // However, we must hold alloc_.mutex_ when decrementing ref_count_ to zero so
+  // that we can atomically remove it from alloc_.counters_ or alloc_.gauges_.
+  // We leave it atomic to avoid taking the lock on increment, and on
+  // decrements that leave other references outstanding.
   std::atomic<uint32_t> ref_count_{0};
 
   std::atomic<uint16_t> flags_{0};
@@ -797,9 +797,7 @@ ClusterInfoImpl::ClusterInfoImpl(
           PROTOBUF_GET_WRAPPED_OR_DEFAULT(config, per_connection_buffer_limit_bytes, 1024 * 1024)),
       socket_matcher_(std::move(socket_matcher)), stats_scope_(std::move(stats_scope)),
       stats_(generateStats(*stats_scope_, factory_context.clusterManager().clusterStatNames())),
-      load_report_stats_store_(stats_scope_->symbolTable()),
-      load_report_stats_(generateLoadReportStats(
-          load_report_stats_store_, factory_context.clusterManager().clusterLoadReportStatNames())),
+      load_report_stat_names_(factory_context.clusterManager().clusterLoadReportStatNames()),
       optional_cluster_stats_((config.has_track_cluster_stats() || config.track_timeout_budgets())
                                   ? std::make_unique<OptionalClusterStats>(
                                         config, *stats_scope_, factory_context.clusterManager())
@@ -1364,6 +1362,18 @@ ClusterInfoImpl::generateCircuitBreakersStats(Stats::Scope& scope, Stats::StatNa
 #undef REMAINING_GAUGE
 }
 
+ClusterInfoImpl::LoadReportStats::LoadReportStats(Stats::SymbolTable& symbol_table,
+                                                  const ClusterLoadReportStatNames& stat_names)
+    : store_(symbol_table), stats_(generateLoadReportStats(store_, stat_names)) {}
+
+ClusterLoadReportStats& ClusterInfoImpl::loadReportStats() const {
+  return load_report_stats_
+      .get([this]() -> LoadReportStats* {
+        return new LoadReportStats(stats_scope_->symbolTable(), load_report_stat_names_);
+      })
+      ->stats_;
+}
+
 Http::Http1::CodecStats& ClusterInfoImpl::http1CodecStats() const {
   return Http::Http1::CodecStats::atomicGet(http1_codec_stats_, *stats_scope_);
 }
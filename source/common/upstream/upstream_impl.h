@@ -686,7 +686,7 @@ public:
     return std::ref(*(optional_cluster_stats_->request_response_size_stats_));
   }
 
-  ClusterLoadReportStats& loadReportStats() const override { return load_report_stats_; }
+  ClusterLoadReportStats& loadReportStats() const override;
 
   ClusterTimeoutBudgetStatsOptRef timeoutBudgetStats() const override {
     if (optional_cluster_stats_ == nullptr ||
@@ -765,6 +765,18 @@ private:
     const ClusterRequestResponseSizeStatsPtr request_response_size_stats_;
   };
 
+  // Load report stats live in their own isolated store so that they never show up in admin or
+  // sinks. Most clusters never drop a request nor are reported via LRS, so the store is created on
+  // first use rather than with every cluster.
+  struct LoadReportStats {
+    LoadReportStats(Stats::SymbolTable& symbol_table,
+                    const ClusterLoadReportStatNames& stat_names);
+    Stats::IsolatedStoreImpl store_;
+    ClusterLoadReportStats stats_;
+  };
+  using LoadReportStatsAtomicPtr =
+      Thread::AtomicPtr<LoadReportStats, Thread::AtomicPtrAllocMode::DeleteOnDestruct>;
+
   Runtime::Loader& runtime_;
   const std::string name_;
   const std::string observability_name_;
@@ -783,8 +795,8 @@ private:
   TransportSocketMatcherPtr socket_matcher_;
   Stats::ScopePtr stats_scope_;
   mutable ClusterStats stats_;
-  Stats::IsolatedStoreImpl load_report_stats_store_;
-  mutable ClusterLoadReportStats load_report_stats_;
+  const ClusterLoadReportStatNames& load_report_stat_names_;
+  mutable LoadReportStatsAtomicPtr load_report_stats_;
   const std::unique_ptr<OptionalClusterStats> optional_cluster_stats_;
   const uint64_t features_;
   mutable ResourceManagers resource_managers_;
@@ -189,24 +189,9 @@ public:
     flush_timer_->enableTimer(buffer_flush_interval_msec_);
   }
 
-  void log(HttpLogProto&& entry) override {
-    if (!canLogMore()) {
-      return;
-    }
-    approximate_message_size_bytes_ += entry.ByteSizeLong();
-    addEntry(std::move(entry));
-    if (approximate_message_size_bytes_ >= max_buffer_size_bytes_) {
-      flush();
-    }
-  }
+  void log(HttpLogProto&& entry) override { logEntry(std::move(entry)); }
 
-  void log(TcpLogProto&& entry) override {
-    approximate_message_size_bytes_ += entry.ByteSizeLong();
-    addEntry(std::move(entry));
-    if (approximate_message_size_bytes_ >= max_buffer_size_bytes_) {
-      flush();
-    }
-  }
+  void log(TcpLogProto&& entry) override { logEntry(std::move(entry)); }
 
 protected:
   Detail::GrpcAccessLogClient<LogRequest, LogResponse> client_;
@@ -219,6 +204,20 @@ private:
   virtual void addEntry(TcpLogProto&& entry) PURE;
   virtual void clearMessage() { message_.Clear(); }
 
+  // HTTP and TCP entries share the same buffer, so both are subject to the same size bound and
+  // drop accounting. Without this, TCP entries would keep accumulating while the stream is backed
+  // up.
+  template <typename LogProto> void logEntry(LogProto&& entry) {
+    if (!canLogMore()) {
+      return;
+    }
+    approximate_message_size_bytes_ += entry.ByteSizeLong();
+    addEntry(std::forward<LogProto>(entry));
+    if (approximate_message_size_bytes_ >= max_buffer_size_bytes_) {
+      flush();
+    }
+  }
+
   void flush() {
     if (isEmpty()) {
       // Nothing to flush.
@@ -32,7 +32,12 @@ Cluster::Cluster(
       dns_cache_manager_(cache_manager_factory.get()),
       dns_cache_(dns_cache_manager_->getCache(config.dns_cache_config())),
       update_callbacks_handle_(dns_cache_->addUpdateCallbacks(*this)), local_info_(local_info),
-      allow_coalesced_connections_(config.allow_coalesced_connections()) {}
+      allow_coalesced_connections_(config.allow_coalesced_connections()),
+      host_set_update_interval_(PROTOBUF_GET_MS_OR_DEFAULT(config, host_set_update_interval, 0)),
+      host_set_update_timer_(config.has_host_set_update_interval()
+                                 ? factory_context.mainThreadDispatcher().createTimer(
+                                       [this]() { onHostSetUpdateTimer(); })
+                                 : nullptr) {}
 
 void Cluster::startPreInit() {
   // If we are attaching to a pre-populated cache we need to initialize our hosts.
@@ -116,8 +121,37 @@ void Cluster::onDnsHostAddOrUpdate(
   addOrUpdateHost(host, host_info, hosts_added);
   if (hosts_added != nullptr) {
     ASSERT(!hosts_added->empty());
-    updatePriorityState(*hosts_added, {});
+    updateHostSet(*hosts_added, {});
+  }
+}
+
+void Cluster::updateHostSet(const Upstream::HostVector& hosts_added,
+                            const Upstream::HostVector& hosts_removed) {
+  if (host_set_update_timer_ == nullptr) {
+    updatePriorityState(hosts_added, hosts_removed);
+    return;
   }
+
+  // A host that is added and removed within one batch is reported as both added and removed. It
+  // never enters the host set, but the load balancer may already have chosen it, and the cluster
+  // manager only drains the connection pools of hosts that are reported as removed.
+  pending_hosts_added_.insert(pending_hosts_added_.end(), hosts_added.begin(), hosts_added.end());
+  pending_hosts_removed_.insert(pending_hosts_removed_.end(), hosts_removed.begin(),
+                                hosts_removed.end());
+  if (!host_set_update_timer_->enabled()) {
+    host_set_update_timer_->enableTimer(host_set_update_interval_);
+  }
+}
+
+void Cluster::onHostSetUpdateTimer() {
+  ENVOY_LOG(debug, "applying {} added and {} removed hosts to the dfproxy cluster host set",
+            pending_hosts_added_.size(), pending_hosts_removed_.size());
+  Upstream::HostVector hosts_added;
+  Upstream::HostVector hosts_removed;
+  hosts_added.swap(pending_hosts_added_);
+  hosts_removed.swap(pending_hosts_removed_);
+  // The host set is rebuilt from the host map, which already reflects every pending change.
+  updatePriorityState(hosts_added, hosts_removed);
 }
 
 void Cluster::updatePriorityState(const Upstream::HostVector& hosts_added,
@@ -146,7 +180,7 @@ void Cluster::onDnsHostRemove(const std::string& host) {
     host_map_.erase(host);
     ENVOY_LOG(debug, "removing dfproxy cluster host '{}'", host);
   }
-  updatePriorityState({}, hosts_removed);
+  updateHostSet({}, hosts_removed);
 }
 
 Upstream::HostConstSharedPtr
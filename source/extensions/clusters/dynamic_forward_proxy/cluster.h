@@ -2,6 +2,7 @@
 
 #include "envoy/config/cluster/v3/cluster.pb.h"
 #include "envoy/config/endpoint/v3/endpoint_components.pb.h"
+#include "envoy/event/timer.h"
 #include "envoy/extensions/clusters/dynamic_forward_proxy/v3/cluster.pb.h"
 #include "envoy/extensions/clusters/dynamic_forward_proxy/v3/cluster.pb.validate.h"
 #include "envoy/http/conn_pool.h"
@@ -137,6 +138,13 @@ private:
                            const Upstream::HostVector& hosts_removed)
       ABSL_LOCKS_EXCLUDED(host_map_lock_);
 
+  // Applies hosts added to or removed from the host map to the host set, either immediately or in
+  // the next batch if host_set_update_interval is configured.
+  void updateHostSet(const Upstream::HostVector& hosts_added,
+                     const Upstream::HostVector& hosts_removed)
+      ABSL_LOCKS_EXCLUDED(host_map_lock_);
+  void onHostSetUpdateTimer() ABSL_LOCKS_EXCLUDED(host_map_lock_);
+
   const Extensions::Common::DynamicForwardProxy::DnsCacheManagerSharedPtr dns_cache_manager_;
   const Extensions::Common::DynamicForwardProxy::DnsCacheSharedPtr dns_cache_;
   const Extensions::Common::DynamicForwardProxy::DnsCache::AddUpdateCallbacksHandlePtr
@@ -148,6 +156,13 @@ private:
   // True if H2 and H3 connections may be reused across different origins.
   const bool allow_coalesced_connections_;
 
+  // Only set if host set updates are batched. The pending hosts are only accessed from the main
+  // thread.
+  const std::chrono::milliseconds host_set_update_interval_;
+  const Event::TimerPtr host_set_update_timer_;
+  Upstream::HostVector pending_hosts_added_;
+  Upstream::HostVector pending_hosts_removed_;
+
   mutable absl::Mutex host_map_lock_;
   HostInfoMap host_map_ ABSL_GUARDED_BY(host_map_lock_);
 
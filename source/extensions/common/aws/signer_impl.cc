@@ -104,6 +104,23 @@ std::string SignerImpl::createStringToSign(absl::string_view canonical_request,
 std::string SignerImpl::createSignature(absl::string_view secret_access_key,
                                         absl::string_view short_date,
                                         absl::string_view string_to_sign) const {
+  auto& crypto_util = Envoy::Common::Crypto::UtilitySingleton::get();
+  const auto signing_key = getSigningKey(secret_access_key, short_date);
+  return Hex::encode(crypto_util.getSha256Hmac(signing_key->signing_key_, string_to_sign));
+}
+
+SignerImpl::CachedSigningKeyConstSharedPtr
+SignerImpl::getSigningKey(absl::string_view secret_access_key, absl::string_view short_date) const {
+  CachedSigningKeyConstSharedPtr cached;
+  {
+    const Thread::LockGuard lock(signing_key_lock_);
+    cached = cached_signing_key_;
+  }
+  if (cached != nullptr && cached->short_date_ == short_date &&
+      cached->secret_access_key_ == secret_access_key) {
+    return cached;
+  }
+
   auto& crypto_util = Envoy::Common::Crypto::UtilitySingleton::get();
   const auto secret_key =
       absl::StrCat(SignatureConstants::get().SignatureVersion, secret_access_key);
@@ -111,9 +128,14 @@ std::string SignerImpl::createSignature(absl::string_view secret_access_key,
       std::vector<uint8_t>(secret_key.begin(), secret_key.end()), short_date);
   const auto region_key = crypto_util.getSha256Hmac(date_key, region_);
   const auto service_key = crypto_util.getSha256Hmac(region_key, service_name_);
-  const auto signing_key =
-      crypto_util.getSha256Hmac(service_key, SignatureConstants::get().Aws4Request);
-  return Hex::encode(crypto_util.getSha256Hmac(signing_key, string_to_sign));
+  auto derived = std::make_shared<const CachedSigningKey>(CachedSigningKey{
+      std::string(secret_access_key), std::string(short_date),
+      crypto_util.getSha256Hmac(service_key, SignatureConstants::get().Aws4Request)});
+  {
+    const Thread::LockGuard lock(signing_key_lock_);
+    cached_signing_key_ = derived;
+  }
+  return derived;
 }
 
 std::string
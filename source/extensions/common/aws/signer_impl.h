@@ -1,9 +1,11 @@
 #pragma once
 
+#include <memory>
 #include <utility>
 
 #include "source/common/common/logger.h"
 #include "source/common/common/matchers.h"
+#include "source/common/common/thread.h"
 #include "source/common/common/utility.h"
 #include "source/common/http/headers.h"
 #include "source/common/singleton/const_singleton.h"
@@ -79,6 +81,12 @@ private:
   std::string createSignature(absl::string_view secret_access_key, absl::string_view short_date,
                               absl::string_view string_to_sign) const;
 
+  struct CachedSigningKey;
+  using CachedSigningKeyConstSharedPtr = std::shared_ptr<const CachedSigningKey>;
+
+  CachedSigningKeyConstSharedPtr getSigningKey(absl::string_view secret_access_key,
+                                               absl::string_view short_date) const;
+
   std::string createAuthorizationHeader(absl::string_view access_key_id,
                                         absl::string_view credential_scope,
                                         const std::map<std::string, std::string>& canonical_headers,
@@ -106,6 +114,18 @@ private:
   TimeSource& time_source_;
   DateFormatter long_date_formatter_;
   DateFormatter short_date_formatter_;
+
+  // The signing key is derived from the secret access key, the date, the region and the service,
+  // so it only changes once a day or when the credentials are rotated. The signer is shared by all
+  // of the workers, so the most recently derived key is kept behind a lock. The lock only guards
+  // the pointer; keys are derived outside of it and never modified once published.
+  struct CachedSigningKey {
+    std::string secret_access_key_;
+    std::string short_date_;
+    std::vector<uint8_t> signing_key_;
+  };
+  mutable Thread::MutexBasicLockable signing_key_lock_;
+  mutable CachedSigningKeyConstSharedPtr cached_signing_key_ ABSL_GUARDED_BY(signing_key_lock_);
 };
 
 } // namespace Aws
@@ -3,6 +3,7 @@
 #include "envoy/extensions/common/dynamic_forward_proxy/v3/dns_cache.pb.h"
 
 #include "source/common/common/dns_utils.h"
+#include "source/common/common/hash.h"
 #include "source/common/common/stl_helpers.h"
 #include "source/common/config/utility.h"
 #include "source/common/http/utility.h"
@@ -55,10 +56,13 @@ DnsCacheImpl::DnsCacheImpl(
 }
 
 DnsCacheImpl::~DnsCacheImpl() {
-  for (const auto& primary_host : primary_hosts_) {
-    if (primary_host.second->active_query_ != nullptr) {
-      primary_host.second->active_query_->cancel(
-          Network::ActiveDnsQuery::CancelReason::QueryAbandoned);
+  for (auto& shard : primary_host_shards_) {
+    absl::ReaderMutexLock reader_lock{&shard.lock_};
+    for (const auto& primary_host : shard.hosts_) {
+      if (primary_host.second->active_query_ != nullptr) {
+        primary_host.second->active_query_->cancel(
+            Network::ActiveDnsQuery::CancelReason::QueryAbandoned);
+      }
     }
   }
 
@@ -88,11 +92,12 @@ DnsCacheImpl::loadDnsCacheEntry(absl::string_view host, uint16_t default_port,
   ThreadLocalHostInfo& tls_host_info = *tls_slot_;
 
   auto [is_overflow, host_info] = [&]() {
-    absl::ReaderMutexLock read_lock{&primary_hosts_lock_};
-    auto tls_host = primary_hosts_.find(host);
+    auto& shard = primaryHostShard(host);
+    absl::ReaderMutexLock read_lock{&shard.lock_};
+    auto tls_host = shard.hosts_.find(host);
     return std::make_tuple(
-        primary_hosts_.size() >= max_hosts_,
-        (tls_host != primary_hosts_.end() && tls_host->second->host_info_->firstResolveComplete())
+        num_primary_hosts_.load() >= max_hosts_,
+        (tls_host != shard.hosts_.end() && tls_host->second->host_info_->firstResolveComplete())
             ? absl::optional<DnsHostInfoSharedPtr>(tls_host->second->host_info_)
             : absl::nullopt);
   }();
@@ -125,11 +130,13 @@ Upstream::ResourceAutoIncDecPtr DnsCacheImpl::canCreateDnsRequest() {
 }
 
 void DnsCacheImpl::iterateHostMap(IterateHostMapCb iterate_callback) {
-  absl::ReaderMutexLock reader_lock{&primary_hosts_lock_};
-  for (const auto& host : primary_hosts_) {
-    // Only include hosts that have ever resolved to an address.
-    if (host.second->host_info_->address() != nullptr) {
-      iterate_callback(host.first, host.second->host_info_);
+  for (auto& shard : primary_host_shards_) {
+    absl::ReaderMutexLock reader_lock{&shard.lock_};
+    for (const auto& host : shard.hosts_) {
+      // Only include hosts that have ever resolved to an address.
+      if (host.second->host_info_->address() != nullptr) {
+        iterate_callback(host.first, host.second->host_info_);
+      }
     }
   }
 }
@@ -137,9 +144,10 @@ void DnsCacheImpl::iterateHostMap(IterateHostMapCb iterate_callback) {
 absl::optional<const DnsHostInfoSharedPtr> DnsCacheImpl::getHost(absl::string_view host_name) {
   // Find a host with the given name.
   const auto host_info = [&]() -> const DnsHostInfoSharedPtr {
-    absl::ReaderMutexLock reader_lock{&primary_hosts_lock_};
-    auto it = primary_hosts_.find(host_name);
-    return it != primary_hosts_.end() ? it->second->host_info_ : nullptr;
+    auto& shard = primaryHostShard(host_name);
+    absl::ReaderMutexLock reader_lock{&shard.lock_};
+    auto it = shard.hosts_.find(host_name);
+    return it != shard.hosts_.end() ? it->second->host_info_ : nullptr;
   }();
 
   // Only include hosts that have ever resolved to an address.
@@ -162,12 +170,13 @@ void DnsCacheImpl::startCacheLoad(const std::string& host, uint16_t default_port
   // already in the map it's either in the process of being resolved or the resolution is already
   // heading out to the worker threads. Either way the pending resolution will be completed.
 
-  // Functions like this one that modify primary_hosts_ are only called in the main thread so we
+  // Functions like this one that modify the primary hosts are only called in the main thread so we
   // know it is safe to use the PrimaryHostInfo pointers outside of the lock.
   auto* primary_host = [&]() {
-    absl::ReaderMutexLock reader_lock{&primary_hosts_lock_};
-    auto host_it = primary_hosts_.find(host);
-    return host_it != primary_hosts_.end() ? host_it->second.get() : nullptr;
+    auto& shard = primaryHostShard(host);
+    absl::ReaderMutexLock reader_lock{&shard.lock_};
+    auto host_it = shard.hosts_.find(host);
+    return host_it != shard.hosts_.end() ? host_it->second.get() : nullptr;
   }();
 
   if (primary_host) {
@@ -186,8 +195,9 @@ DnsCacheImpl::PrimaryHostInfo* DnsCacheImpl::createHost(const std::string& host,
   // independent primary hosts with independent DNS resolutions. I'm not sure how much this will
   // matter, but we could consider collapsing these down and sharing the underlying DNS resolution.
   {
-    absl::WriterMutexLock writer_lock{&primary_hosts_lock_};
-    return primary_hosts_
+    auto& shard = primaryHostShard(host);
+    absl::WriterMutexLock writer_lock{&shard.lock_};
+    return shard.hosts_
         // try_emplace() is used here for direct argument forwarding.
         .try_emplace(host,
                      std::make_unique<PrimaryHostInfo>(
@@ -200,15 +210,23 @@ DnsCacheImpl::PrimaryHostInfo* DnsCacheImpl::createHost(const std::string& host,
 }
 
 DnsCacheImpl::PrimaryHostInfo& DnsCacheImpl::getPrimaryHost(const std::string& host) {
-  // Functions modify primary_hosts_ are only called in the main thread so we
+  // Functions that modify the primary hosts are only called in the main thread so we
   // know it is safe to use the PrimaryHostInfo pointers outside of the lock.
   ASSERT(main_thread_dispatcher_.isThreadSafe());
-  absl::ReaderMutexLock reader_lock{&primary_hosts_lock_};
-  const auto primary_host_it = primary_hosts_.find(host);
-  ASSERT(primary_host_it != primary_hosts_.end());
+  auto& shard = primaryHostShard(host);
+  absl::ReaderMutexLock reader_lock{&shard.lock_};
+  const auto primary_host_it = shard.hosts_.find(host);
+  ASSERT(primary_host_it != shard.hosts_.end());
   return *(primary_host_it->second.get());
 }
 
+DnsCacheImpl::PrimaryHostShard& DnsCacheImpl::primaryHostShard(absl::string_view host) {
+  // The shard is not picked with absl::Hash. Its low bits are stored in the control bytes of the
+  // shard's map, so all of the hosts in a shard would share some of those bits, making the map
+  // compare more keys on each lookup.
+  return primary_host_shards_[HashUtil::xxHash64(host) % NumPrimaryHostShards];
+}
+
 void DnsCacheImpl::onResolveTimeout(const std::string& host) {
   ASSERT(main_thread_dispatcher_.isThreadSafe());
 
@@ -242,11 +260,12 @@ void DnsCacheImpl::onReResolve(const std::string& host) {
     }
     {
       removeCacheEntry(host);
-      absl::WriterMutexLock writer_lock{&primary_hosts_lock_};
-      auto host_it = primary_hosts_.find(host);
-      ASSERT(host_it != primary_hosts_.end());
+      auto& shard = primaryHostShard(host);
+      absl::WriterMutexLock writer_lock{&shard.lock_};
+      auto host_it = shard.hosts_.find(host);
+      ASSERT(host_it != shard.hosts_.end());
       host_to_erase = std::move(host_it->second);
-      primary_hosts_.erase(host_it);
+      shard.hosts_.erase(host_it);
     }
     notifyThreads(host, primary_host.host_info_);
   } else {
@@ -255,18 +274,20 @@ void DnsCacheImpl::onReResolve(const std::string& host) {
 }
 
 void DnsCacheImpl::forceRefreshHosts() {
-  absl::ReaderMutexLock reader_lock{&primary_hosts_lock_};
-  for (auto& primary_host : primary_hosts_) {
-    // Avoid holding the lock for longer than necessary by just triggering the refresh timer for
-    // each host IFF the host is not already refreshing.
-    // TODO(mattklein123): In the future we may want to cancel an ongoing refresh and start a new
-    // one to avoid a situation in which an older refresh races with a concurrent network change,
-    // for example.
-    if (primary_host.second->active_query_ == nullptr) {
-      ASSERT(!primary_host.second->timeout_timer_->enabled());
-      primary_host.second->refresh_timer_->enableTimer(std::chrono::milliseconds(0), nullptr);
-      ENVOY_LOG_EVENT(debug, "force_refresh_host", "force refreshing host='{}'",
-                      primary_host.first);
+  for (auto& shard : primary_host_shards_) {
+    absl::ReaderMutexLock reader_lock{&shard.lock_};
+    for (auto& primary_host : shard.hosts_) {
+      // Avoid holding the lock for longer than necessary by just triggering the refresh timer for
+      // each host IFF the host is not already refreshing.
+      // TODO(mattklein123): In the future we may want to cancel an ongoing refresh and start a new
+      // one to avoid a situation in which an older refresh races with a concurrent network
+      // change, for example.
+      if (primary_host.second->active_query_ == nullptr) {
+        ASSERT(!primary_host.second->timeout_timer_->enabled());
+        primary_host.second->refresh_timer_->enableTimer(std::chrono::milliseconds(0), nullptr);
+        ENVOY_LOG_EVENT(debug, "force_refresh_host", "force refreshing host='{}'",
+                        primary_host.first);
+      }
     }
   }
 }
@@ -299,12 +320,13 @@ void DnsCacheImpl::finishResolve(const std::string& host,
                   }));
   const bool from_cache = resolution_time.has_value();
 
-  // Functions like this one that modify primary_hosts_ are only called in the main thread so we
+  // Functions like this one that modify the primary hosts are only called in the main thread so we
   // know it is safe to use the PrimaryHostInfo pointers outside of the lock.
   auto* primary_host_info = [&]() {
-    absl::ReaderMutexLock reader_lock{&primary_hosts_lock_};
-    const auto primary_host_it = primary_hosts_.find(host);
-    ASSERT(primary_host_it != primary_hosts_.end());
+    auto& shard = primaryHostShard(host);
+    absl::ReaderMutexLock reader_lock{&shard.lock_};
+    const auto primary_host_it = shard.hosts_.find(host);
+    ASSERT(primary_host_it != shard.hosts_.end());
     return primary_host_it->second.get();
   }();
 
@@ -453,11 +475,13 @@ DnsCacheImpl::PrimaryHostInfo::PrimaryHostInfo(DnsCacheImpl& parent,
               parent_.config_, parent_.refresh_interval_.count(), parent_.random_generator_)) {
   parent_.stats_.host_added_.inc();
   parent_.stats_.num_hosts_.inc();
+  ++parent_.num_primary_hosts_;
 }
 
 DnsCacheImpl::PrimaryHostInfo::~PrimaryHostInfo() {
   parent_.stats_.host_removed_.inc();
   parent_.stats_.num_hosts_.dec();
+  --parent_.num_primary_hosts_;
 }
 
 void DnsCacheImpl::addCacheEntry(
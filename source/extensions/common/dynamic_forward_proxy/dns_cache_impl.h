@@ -1,5 +1,8 @@
 #pragma once
 
+#include <array>
+#include <atomic>
+
 #include "envoy/common/backoff_strategy.h"
 #include "envoy/common/key_value_store.h"
 #include "envoy/extensions/common/dynamic_forward_proxy/v3/dns_cache.pb.h"
@@ -185,6 +188,15 @@ private:
   // individual entries.
   using PrimaryHostInfoPtr = std::unique_ptr<PrimaryHostInfo>;
 
+  // The primary hosts are split across shards by host name, each with its own lock. Every worker
+  // looks up the primary hosts on each request, so a single lock would be contended by all of the
+  // workers even though they only read the map.
+  struct PrimaryHostShard {
+    absl::Mutex lock_;
+    absl::flat_hash_map<std::string, PrimaryHostInfoPtr> hosts_ ABSL_GUARDED_BY(lock_);
+  };
+  static constexpr size_t NumPrimaryHostShards = 16;
+
   struct AddUpdateCallbacksHandleImpl : public AddUpdateCallbacksHandle,
                                         RaiiListElement<AddUpdateCallbacksHandleImpl*> {
     AddUpdateCallbacksHandleImpl(std::list<AddUpdateCallbacksHandleImpl*>& parent,
@@ -196,8 +208,7 @@ private:
 
   void startCacheLoad(const std::string& host, uint16_t default_port);
 
-  void startResolve(const std::string& host, PrimaryHostInfo& host_info)
-      ABSL_LOCKS_EXCLUDED(primary_hosts_lock_);
+  void startResolve(const std::string& host, PrimaryHostInfo& host_info);
 
   void finishResolve(const std::string& host, Network::DnsResolver::ResolutionStatus status,
                      std::list<Network::DnsResponse>&& response,
@@ -208,6 +219,7 @@ private:
   void onReResolve(const std::string& host);
   void onResolveTimeout(const std::string& host);
   PrimaryHostInfo& getPrimaryHost(const std::string& host);
+  PrimaryHostShard& primaryHostShard(absl::string_view host);
 
   void addCacheEntry(const std::string& host,
                      const Network::Address::InstanceConstSharedPtr& address,
@@ -229,9 +241,10 @@ private:
   Stats::ScopePtr scope_;
   DnsCacheStats stats_;
   std::list<AddUpdateCallbacksHandleImpl*> update_callbacks_;
-  absl::Mutex primary_hosts_lock_;
-  absl::flat_hash_map<std::string, PrimaryHostInfoPtr>
-      primary_hosts_ ABSL_GUARDED_BY(primary_hosts_lock_);
+  // The number of primary hosts across all of the shards, used to enforce max_hosts_. This is
+  // declared before the shards as it is updated when the primary hosts are destroyed.
+  std::atomic<size_t> num_primary_hosts_{0};
+  std::array<PrimaryHostShard, NumPrimaryHostShards> primary_host_shards_;
   std::unique_ptr<KeyValueStore> key_value_store_;
   DnsCacheResourceManagerImpl resource_manager_;
   const std::chrono::milliseconds refresh_interval_;
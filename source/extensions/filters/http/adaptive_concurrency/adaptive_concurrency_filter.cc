@@ -8,6 +8,7 @@
 #include "envoy/extensions/filters/http/adaptive_concurrency/v3/adaptive_concurrency.pb.h"
 
 #include "source/common/common/assert.h"
+#include "source/common/http/utility.h"
 #include "source/common/protobuf/utility.h"
 #include "source/extensions/filters/http/adaptive_concurrency/controller/controller.h"
 
@@ -24,8 +25,31 @@ AdaptiveConcurrencyFilterConfig::AdaptiveConcurrencyFilterConfig(
       adaptive_concurrency_feature_(proto_config.enabled(), runtime) {}
 
 AdaptiveConcurrencyFilter::AdaptiveConcurrencyFilter(
-    AdaptiveConcurrencyFilterConfigSharedPtr config, ConcurrencyControllerSharedPtr controller)
-    : config_(std::move(config)), controller_(std::move(controller)) {}
+    AdaptiveConcurrencyFilterConfigSharedPtr config, ConcurrencyControllerSharedPtr controller,
+    NamedConcurrencyControllersSharedPtr named_controllers)
+    : config_(std::move(config)), controller_(std::move(controller)),
+      named_controllers_(std::move(named_controllers)) {}
+
+void AdaptiveConcurrencyFilter::selectRouteController() {
+  if (named_controllers_ == nullptr || named_controllers_->empty()) {
+    return;
+  }
+
+  const auto* route_config =
+      Http::Utility::resolveMostSpecificPerFilterConfig<AdaptiveConcurrencyRouteConfig>(
+          "envoy.filters.http.adaptive_concurrency", decoder_callbacks_->route());
+  if (route_config == nullptr) {
+    return;
+  }
+
+  const auto it = named_controllers_->find(route_config->controllerName());
+  if (it == named_controllers_->end()) {
+    ENVOY_LOG(debug, "unknown concurrency controller '{}', using the default controller",
+              route_config->controllerName());
+    return;
+  }
+  controller_ = it->second;
+}
 
 Http::FilterHeadersStatus AdaptiveConcurrencyFilter::decodeHeaders(Http::RequestHeaderMap&, bool) {
   // In addition to not sampling if the filter is disabled, health checks should also not be sampled
@@ -35,6 +59,7 @@ Http::FilterHeadersStatus AdaptiveConcurrencyFilter::decodeHeaders(Http::Request
     return Http::FilterHeadersStatus::Continue;
   }
 
+  selectRouteController();
   if (controller_->forwardingDecision() == Controller::RequestForwardingAction::Block) {
     decoder_callbacks_->sendLocalReply(Http::Code::ServiceUnavailable, "reached concurrency limit",
                                        nullptr, absl::nullopt, "reached_concurrency_limit");
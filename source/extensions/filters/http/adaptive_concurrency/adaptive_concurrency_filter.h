@@ -7,6 +7,7 @@
 #include "envoy/common/time.h"
 #include "envoy/extensions/filters/http/adaptive_concurrency/v3/adaptive_concurrency.pb.h"
 #include "envoy/http/filter.h"
+#include "envoy/router/router.h"
 #include "envoy/runtime/runtime.h"
 #include "envoy/stats/scope.h"
 #include "envoy/stats/stats_macros.h"
@@ -16,6 +17,8 @@
 #include "source/extensions/filters/http/adaptive_concurrency/controller/controller.h"
 #include "source/extensions/filters/http/common/pass_through_filter.h"
 
+#include "absl/container/flat_hash_map.h"
+
 namespace Envoy {
 namespace Extensions {
 namespace HttpFilters {
@@ -45,6 +48,27 @@ using AdaptiveConcurrencyFilterConfigSharedPtr =
     std::shared_ptr<const AdaptiveConcurrencyFilterConfig>;
 using ConcurrencyControllerSharedPtr = std::shared_ptr<Controller::ConcurrencyController>;
 
+// Concurrency controllers that routes can select by name in place of the default controller.
+using NamedConcurrencyControllers =
+    absl::flat_hash_map<std::string, ConcurrencyControllerSharedPtr>;
+using NamedConcurrencyControllersSharedPtr = std::shared_ptr<const NamedConcurrencyControllers>;
+
+/**
+ * Per-route configuration for the adaptive concurrency limit filter.
+ */
+class AdaptiveConcurrencyRouteConfig : public Router::RouteSpecificFilterConfig {
+public:
+  AdaptiveConcurrencyRouteConfig(
+      const envoy::extensions::filters::http::adaptive_concurrency::v3::AdaptiveConcurrencyPerRoute&
+          proto_config)
+      : controller_name_(proto_config.controller_name()) {}
+
+  const std::string& controllerName() const { return controller_name_; }
+
+private:
+  const std::string controller_name_;
+};
+
 /**
  * A filter that samples request latencies and dynamically adjusts the request
  * concurrency window.
@@ -53,7 +77,8 @@ class AdaptiveConcurrencyFilter : public Http::PassThroughFilter,
                                   Logger::Loggable<Logger::Id::filter> {
 public:
   AdaptiveConcurrencyFilter(AdaptiveConcurrencyFilterConfigSharedPtr config,
-                            ConcurrencyControllerSharedPtr controller);
+                            ConcurrencyControllerSharedPtr controller,
+                            NamedConcurrencyControllersSharedPtr named_controllers = nullptr);
 
   // Http::StreamDecoderFilter
   Http::FilterHeadersStatus decodeHeaders(Http::RequestHeaderMap&, bool) override;
@@ -63,8 +88,13 @@ public:
   void onDestroy() override;
 
 private:
+  void selectRouteController();
+
   AdaptiveConcurrencyFilterConfigSharedPtr config_;
-  const ConcurrencyControllerSharedPtr controller_;
+  // The controller for this stream. This starts as the default controller and is replaced if the
+  // route selects one of the named controllers.
+  ConcurrencyControllerSharedPtr controller_;
+  const NamedConcurrencyControllersSharedPtr named_controllers_;
   std::unique_ptr<Cleanup> deferred_sample_task_;
 };
 
@@ -7,6 +7,8 @@
 #include "source/extensions/filters/http/adaptive_concurrency/adaptive_concurrency_filter.h"
 #include "source/extensions/filters/http/adaptive_concurrency/controller/gradient_controller.h"
 
+#include "absl/strings/str_cat.h"
+
 namespace Envoy {
 namespace Extensions {
 namespace HttpFilters {
@@ -29,16 +31,37 @@ Http::FilterFactoryCb AdaptiveConcurrencyFilterFactory::createFilterFactoryFromP
       acc_stats_prefix + "gradient_controller.", context.scope(), context.api().randomGenerator(),
       context.timeSource());
 
+  // Each named controller gets its own stats namespace so that its limit can be observed separately
+  // from the default controller.
+  auto named_controllers = std::make_shared<NamedConcurrencyControllers>();
+  for (const auto& [name, named_config] : config.named_gradient_controllers()) {
+    named_controllers->emplace(
+        name, std::make_shared<Controller::GradientController>(
+                  Controller::GradientControllerConfig(named_config, context.runtime()),
+                  context.mainThreadDispatcher(), context.runtime(),
+                  absl::StrCat(acc_stats_prefix, name, ".gradient_controller."), context.scope(),
+                  context.api().randomGenerator(), context.timeSource()));
+  }
+
   AdaptiveConcurrencyFilterConfigSharedPtr filter_config(
       new AdaptiveConcurrencyFilterConfig(config, context.runtime(), std::move(acc_stats_prefix),
                                           context.scope(), context.timeSource()));
 
-  return [filter_config, controller](Http::FilterChainFactoryCallbacks& callbacks) -> void {
+  return [filter_config, controller,
+          named_controllers](Http::FilterChainFactoryCallbacks& callbacks) -> void {
     callbacks.addStreamFilter(
-        std::make_shared<AdaptiveConcurrencyFilter>(filter_config, controller));
+        std::make_shared<AdaptiveConcurrencyFilter>(filter_config, controller, named_controllers));
   };
 }
 
+Router::RouteSpecificFilterConfigConstSharedPtr
+AdaptiveConcurrencyFilterFactory::createRouteSpecificFilterConfigTyped(
+    const envoy::extensions::filters::http::adaptive_concurrency::v3::AdaptiveConcurrencyPerRoute&
+        proto_config,
+    Server::Configuration::ServerFactoryContext&, ProtobufMessage::ValidationVisitor&) {
+  return std::make_shared<const AdaptiveConcurrencyRouteConfig>(proto_config);
+}
+
 /**
  * Static registration for the adaptive_concurrency filter. @see RegisterFactory.
  */
@@ -22,6 +22,18 @@ namespace HttpFilters {
 namespace AdaptiveConcurrency {
 namespace Controller {
 
+namespace {
+
+// Returns an index that is fixed for the lifetime of the calling thread. Consecutive threads get
+// consecutive indices, so worker threads are spread evenly across the latency sample shards.
+uint32_t threadSampleShardIndex() {
+  static std::atomic<uint32_t> next_index{0};
+  static thread_local const uint32_t index = next_index++;
+  return index;
+}
+
+} // namespace
+
 GradientControllerConfig::GradientControllerConfig(
     const envoy::extensions::filters::http::adaptive_concurrency::v3::GradientControllerConfig&
         proto_config,
@@ -51,7 +63,7 @@ GradientController::GradientController(GradientControllerConfig config,
       stats_(generateStats(scope_, stats_prefix)), random_(random), time_source_(time_source),
       deferred_limit_value_(0), num_rq_outstanding_(0),
       concurrency_limit_(config_.minConcurrency()),
-      latency_sample_hist_(hist_fast_alloc(), hist_free) {
+      latency_sample_hist_(hist_fast_alloc(), hist_free), num_merged_latency_samples_(0) {
   min_rtt_calc_timer_ = dispatcher_.createTimer([this]() -> void { enterMinRTTSamplingWindow(); });
 
   sample_reset_timer_ = dispatcher_.createTimer([this]() -> void {
@@ -102,7 +114,7 @@ void GradientController::enterMinRTTSamplingWindow() {
 
   // Throw away any latency samples from before the recalculation window as it may not represent
   // the minRTT.
-  hist_clear(latency_sample_hist_.get());
+  clearLatencySamples();
 
   min_rtt_epoch_ = time_source_.monotonicTime();
 }
@@ -110,8 +122,12 @@ void GradientController::enterMinRTTSamplingWindow() {
 void GradientController::updateMinRTT() {
   // Only update minRTT when it is in minRTT sampling window and
   // number of samples is greater than or equal to the minRTTAggregateRequestCount.
-  if (!inMinRTTSamplingWindow() ||
-      hist_sample_count(latency_sample_hist_.get()) < config_.minRTTAggregateRequestCount()) {
+  if (!inMinRTTSamplingWindow()) {
+    return;
+  }
+
+  mergeLatencySamples();
+  if (hist_sample_count(latency_sample_hist_.get()) < config_.minRTTAggregateRequestCount()) {
     return;
   }
 
@@ -141,6 +157,7 @@ void GradientController::resetSampleWindow() {
   // The sampling window must not be reset while sampling for the new minRTT value.
   ASSERT(!inMinRTTSamplingWindow());
 
+  mergeLatencySamples();
   if (hist_sample_count(latency_sample_hist_.get()) == 0) {
     return;
   }
@@ -156,9 +173,39 @@ std::chrono::microseconds GradientController::processLatencySamplesAndClear() {
   std::array<double, 1> calculated_quantile;
   hist_approx_quantile(latency_sample_hist_.get(), quantile.data(), 1, calculated_quantile.data());
   hist_clear(latency_sample_hist_.get());
+  num_merged_latency_samples_.store(0);
   return std::chrono::microseconds(static_cast<int>(calculated_quantile[0]));
 }
 
+void GradientController::mergeLatencySamples() {
+  for (LatencySampleShard& shard : latency_sample_shards_) {
+    absl::MutexLock ml(&shard.mtx_);
+    const histogram_t* shard_hist = shard.hist_.get();
+    hist_accumulate(latency_sample_hist_.get(), &shard_hist, 1);
+    hist_clear(shard.hist_.get());
+    shard.num_samples_.store(0);
+  }
+  num_merged_latency_samples_.store(hist_sample_count(latency_sample_hist_.get()));
+}
+
+void GradientController::clearLatencySamples() {
+  for (LatencySampleShard& shard : latency_sample_shards_) {
+    absl::MutexLock ml(&shard.mtx_);
+    hist_clear(shard.hist_.get());
+    shard.num_samples_.store(0);
+  }
+  hist_clear(latency_sample_hist_.get());
+  num_merged_latency_samples_.store(0);
+}
+
+uint64_t GradientController::numLatencySamples() const {
+  uint64_t num_samples = num_merged_latency_samples_.load();
+  for (const LatencySampleShard& shard : latency_sample_shards_) {
+    num_samples += shard.num_samples_.load();
+  }
+  return num_samples;
+}
+
 uint32_t GradientController::calculateNewLimit() {
   ASSERT(sample_rtt_.count() > 0);
 
@@ -211,8 +258,18 @@ void GradientController::recordLatencySample(MonotonicTime rq_send_time) {
                                                             rq_send_time);
   synchronizer_.syncPoint("pre_hist_insert");
   {
+    LatencySampleShard& shard =
+        latency_sample_shards_[threadSampleShardIndex() % NumLatencySampleShards];
+    absl::MutexLock ml(&shard.mtx_);
+    hist_insert(shard.hist_.get(), rq_latency.count(), 1);
+    shard.num_samples_.store(shard.num_samples_.load() + 1);
+  }
+
+  // The shard counts are only summed while a minRTT calculation is in progress. They are read
+  // without holding the sample mutation mutex, so updateMinRTT() checks the merged samples again
+  // before completing the calculation.
+  if (inMinRTTSamplingWindow() && numLatencySamples() >= config_.minRTTAggregateRequestCount()) {
     absl::MutexLock ml(&sample_mutation_mtx_);
-    hist_insert(latency_sample_hist_.get(), rq_latency.count(), 1);
     updateMinRTT();
   }
 }
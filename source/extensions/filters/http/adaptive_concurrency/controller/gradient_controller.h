@@ -1,5 +1,7 @@
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <chrono>
 #include <vector>
 
@@ -208,6 +210,12 @@ using GradientControllerConfigSharedPtr = std::shared_ptr<GradientControllerConf
  * prevent the overlap of these windows. It is necessary for a worker thread to know specifically if
  * the controller is inside of a minRTT recalculation window during the recording of a latency
  * sample, so this extra bit of information is stored in inMinRTTSamplingWindow().
+ *
+ * Latency samples are not recorded under the sample mutation mutex. Each thread inserts its samples
+ * into one of several sample shards, each guarded by its own mutex, so that worker threads do not
+ * serialize on every completed request. The shards are merged while holding the sample mutation
+ * mutex whenever the samples are processed. The sample mutation mutex is only taken on the request
+ * path once enough samples are recorded to complete a minRTT calculation.
  */
 class GradientController : public ConcurrencyController {
 public:
@@ -231,6 +239,11 @@ private:
   static GradientControllerStats generateStats(Stats::Scope& scope,
                                                const std::string& stats_prefix);
   void updateMinRTT() ABSL_EXCLUSIVE_LOCKS_REQUIRED(sample_mutation_mtx_);
+  void mergeLatencySamples() ABSL_EXCLUSIVE_LOCKS_REQUIRED(sample_mutation_mtx_);
+  void clearLatencySamples() ABSL_EXCLUSIVE_LOCKS_REQUIRED(sample_mutation_mtx_);
+  // Returns the number of latency samples held by the shards and latency_sample_hist_ without
+  // taking any lock. The result may be stale.
+  uint64_t numLatencySamples() const;
   std::chrono::microseconds processLatencySamplesAndClear()
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(sample_mutation_mtx_);
   uint32_t calculateNewLimit() ABSL_EXCLUSIVE_LOCKS_REQUIRED(sample_mutation_mtx_);
@@ -278,6 +291,28 @@ private:
   std::unique_ptr<histogram_t, decltype(&hist_free)>
       latency_sample_hist_ ABSL_GUARDED_BY(sample_mutation_mtx_);
 
+  // Latency samples recorded by a subset of the threads that have not been merged into
+  // latency_sample_hist_ yet. Each shard is given its own cache line so that threads recording into
+  // neighbouring shards do not contend on it.
+  struct alignas(64) LatencySampleShard {
+    LatencySampleShard() : hist_(hist_fast_alloc(), hist_free) {}
+
+    absl::Mutex mtx_;
+    std::unique_ptr<histogram_t, decltype(&hist_free)> hist_ ABSL_GUARDED_BY(mtx_);
+    // The number of samples in hist_. It is only modified while holding mtx_, but may be read
+    // without it to tell whether a minRTT calculation can complete.
+    std::atomic<uint64_t> num_samples_{0};
+  };
+
+  // Threads are spread across the shards, so this bounds the number of threads that contend on a
+  // single shard when there are more threads than shards.
+  static constexpr uint32_t NumLatencySampleShards = 32;
+  std::array<LatencySampleShard, NumLatencySampleShards> latency_sample_shards_;
+
+  // The number of samples in latency_sample_hist_. It is only modified while holding the sample
+  // mutation mutex, which happens when the shards are merged or cleared.
+  std::atomic<uint64_t> num_merged_latency_samples_;
+
   // Tracks the number of consecutive times that the concurrency limit is set to the minimum. This
   // is used to determine whether the controller should trigger an additional minRTT measurement
   // after remaining at the minimum limit for too long.
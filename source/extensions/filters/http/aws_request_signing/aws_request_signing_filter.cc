@@ -66,16 +66,20 @@ Http::FilterDataStatus Filter::decodeData(Buffer::Instance& data, bool end_strea
     return Http::FilterDataStatus::Continue;
   }
 
+  // Hash the body as it arrives rather than all at once when the stream ends, so that hashing a
+  // large body does not delay the request once its last chunk has been received.
+  if (payload_hasher_ == nullptr) {
+    payload_hasher_ = Envoy::Common::Crypto::UtilitySingleton::get().createSha256Hasher();
+  }
+  payload_hasher_->update(data);
+
   if (!end_stream) {
     return Http::FilterDataStatus::StopIterationAndBuffer;
   }
 
   decoder_callbacks_->addDecodedData(data, false);
 
-  const Buffer::Instance& decoding_buffer = *decoder_callbacks_->decodingBuffer();
-
-  auto& hashing_util = Envoy::Common::Crypto::UtilitySingleton::get();
-  const std::string hash = Hex::encode(hashing_util.getSha256Digest(decoding_buffer));
+  const std::string hash = Hex::encode(payload_hasher_->finish());
 
   try {
     ENVOY_LOG(debug, "aws request signing from decodeData");
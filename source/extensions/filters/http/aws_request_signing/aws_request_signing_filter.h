@@ -5,6 +5,7 @@
 #include "envoy/stats/scope.h"
 #include "envoy/stats/stats_macros.h"
 
+#include "source/common/crypto/utility.h"
 #include "source/extensions/common/aws/signer.h"
 #include "source/extensions/filters/http/common/pass_through_filter.h"
 
@@ -97,6 +98,7 @@ public:
 private:
   std::shared_ptr<FilterConfig> config_;
   Http::RequestHeaderMap* request_headers_{};
+  Envoy::Common::Crypto::Sha256HasherPtr payload_hasher_;
 };
 
 } // namespace AwsRequestSigningFilter
@@ -48,9 +48,10 @@ FilterConfig::FilterConfig(const BandwidthLimit& config, Stats::Scope& scope,
   }
 
   // The token bucket is configured with a max token count of the number of
-  // bytes per second, and refills at the same rate, so that we have a per
-  // second limit which refills gradually in 1/fill_interval increments.
-  token_bucket_ = std::make_shared<SharedTokenBucketImpl>(
+  // bytes per second, and refills continuously at the same rate, so that we
+  // have a per second limit. The bucket is shared by the streams on all of the
+  // workers and does not take a lock, so the workers never wait on each other.
+  token_bucket_ = std::make_shared<AtomicTokenBucketImpl>(
       StreamRateLimiter::kiloBytesToBytes(limit_kbps_), time_source,
       StreamRateLimiter::kiloBytesToBytes(limit_kbps_));
 }
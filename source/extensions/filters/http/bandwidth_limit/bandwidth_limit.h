@@ -13,7 +13,7 @@
 #include "envoy/stats/timespan.h"
 
 #include "source/common/common/assert.h"
-#include "source/common/common/shared_token_bucket_impl.h"
+#include "source/common/common/atomic_token_bucket_impl.h"
 #include "source/common/http/header_map_impl.h"
 #include "source/common/router/header_parser.h"
 #include "source/common/runtime/runtime_protos.h"
@@ -70,7 +70,7 @@ public:
   uint64_t limit() const { return limit_kbps_; }
   bool enabled() const { return enabled_.enabled(); }
   EnableMode enableMode() const { return enable_mode_; };
-  const std::shared_ptr<SharedTokenBucketImpl> tokenBucket() const { return token_bucket_; }
+  const std::shared_ptr<AtomicTokenBucketImpl> tokenBucket() const { return token_bucket_; }
   std::chrono::milliseconds fillInterval() const { return fill_interval_; }
   const Http::LowerCaseString& requestDelayTrailer() const { return request_delay_trailer_; }
   const Http::LowerCaseString& responseDelayTrailer() const { return response_delay_trailer_; }
@@ -89,7 +89,7 @@ private:
   const Runtime::FeatureFlag enabled_;
   mutable BandwidthLimitStats stats_;
   // Filter chain's shared token bucket
-  std::shared_ptr<SharedTokenBucketImpl> token_bucket_;
+  std::shared_ptr<AtomicTokenBucketImpl> token_bucket_;
   const Http::LowerCaseString request_delay_trailer_;
   const Http::LowerCaseString response_delay_trailer_;
   const bool enable_response_trailers_;
@@ -218,9 +218,11 @@ Http::FilterDataStatus GrpcWebFilter::decodeData(Buffer::Instance& data, bool en
 
   const uint64_t needed = available / 4 * 4 - decoding_buffer_.length();
   decoding_buffer_.move(data, needed);
-  const std::string decoded = Base64::decode(
-      std::string(static_cast<const char*>(decoding_buffer_.linearize(decoding_buffer_.length())),
-                  decoding_buffer_.length()));
+  // Decode straight out of the linearized buffer; it is already contiguous when the base64 data
+  // arrived in a single slice, so no intermediate string copy of the input is made.
+  const uint64_t encoded_length = decoding_buffer_.length();
+  const std::string decoded = Base64::decode(absl::string_view(
+      static_cast<const char*>(decoding_buffer_.linearize(encoded_length)), encoded_length));
   if (decoded.empty()) {
     // Error happened when decoding base64.
     decoder_callbacks_->sendLocalReply(Http::Code::BadRequest,
@@ -307,16 +309,18 @@ Http::FilterDataStatus GrpcWebFilter::encodeData(Buffer::Instance& data, bool en
     return Http::FilterDataStatus::StopIterationNoBuffer;
   }
 
-  // Encodes the decoded gRPC frames with base64.
+  // Encodes the decoded gRPC frames with base64. The frame payload slices are moved behind the
+  // frame header rather than copied, the encoder reads them in place.
+  Buffer::OwnedImpl temp;
   for (auto& frame : frames) {
-    Buffer::OwnedImpl temp;
     temp.add(&frame.flags_, 1);
     const uint32_t length = htonl(frame.length_);
     temp.add(&length, 4);
     if (frame.length_ > 0) {
-      temp.add(*frame.data_);
+      temp.move(*frame.data_);
     }
     data.add(Base64::encode(temp, temp.length()));
+    temp.drain(temp.length());
   }
   return Http::FilterDataStatus::Continue;
 }
@@ -45,11 +45,18 @@ Http::FilterFactoryCb HealthCheckFilterConfig::createFilterFactoryFromProtoTyped
     cluster_min_healthy_percentages = std::move(cluster_to_percentage);
   }
 
+  ClusterHealthResponseCacheManagerSharedPtr cluster_health_cache;
+  if (cluster_min_healthy_percentages != nullptr) {
+    cluster_health_cache = std::make_shared<ClusterHealthResponseCacheManager>(
+        context.threadLocal(), context.clusterManager(), cluster_min_healthy_percentages);
+  }
+
   return [&context, pass_through_mode, cache_manager, header_match_data,
-          cluster_min_healthy_percentages](Http::FilterChainFactoryCallbacks& callbacks) -> void {
-    callbacks.addStreamFilter(std::make_shared<HealthCheckFilter>(context, pass_through_mode,
-                                                                  cache_manager, header_match_data,
-                                                                  cluster_min_healthy_percentages));
+          cluster_min_healthy_percentages,
+          cluster_health_cache](Http::FilterChainFactoryCallbacks& callbacks) -> void {
+    callbacks.addStreamFilter(std::make_shared<HealthCheckFilter>(
+        context, pass_through_mode, cache_manager, header_match_data,
+        cluster_min_healthy_percentages, cluster_health_cache));
   };
 }
 
@@ -50,6 +50,116 @@ void HealthCheckCacheManager::onTimer() {
   clear_cache_timer_->enableTimer(timeout_);
 }
 
+ClusterHealthResponse
+computeClusterHealthResponse(Upstream::ClusterManager& cluster_manager,
+                             const ClusterMinHealthyPercentages& cluster_min_healthy_percentages) {
+  ClusterHealthResponse response{Http::Code::OK, &RcDetails::get().HealthCheckOk};
+  for (const auto& item : cluster_min_healthy_percentages) {
+    response.details_ = &RcDetails::get().HealthCheckClusterHealthy;
+    const std::string& cluster_name = item.first;
+    const uint64_t min_healthy_percentage = static_cast<uint64_t>(item.second);
+    auto* cluster = cluster_manager.getThreadLocalCluster(cluster_name);
+    if (cluster == nullptr) {
+      // If the cluster does not exist at all, consider the service unhealthy.
+      return {Http::Code::ServiceUnavailable, &RcDetails::get().HealthCheckNoCluster};
+    }
+    const auto& stats = cluster->info()->stats();
+    const uint64_t membership_total = stats.membership_total_.value();
+    if (membership_total == 0) {
+      // If the cluster exists but is empty, consider the service unhealthy unless
+      // the specified minimum percent healthy for the cluster happens to be zero.
+      if (min_healthy_percentage == 0UL) {
+        continue;
+      } else {
+        return {Http::Code::ServiceUnavailable, &RcDetails::get().HealthCheckClusterEmpty};
+      }
+    }
+    // In the general case, consider the service unhealthy if fewer than the
+    // specified percentage of the servers in the cluster are available (healthy + degraded).
+    if ((100UL * (stats.membership_healthy_.value() + stats.membership_degraded_.value())) <
+        membership_total * min_healthy_percentage) {
+      return {Http::Code::ServiceUnavailable, &RcDetails::get().HealthCheckClusterUnhealthy};
+    }
+  }
+  return response;
+}
+
+ClusterHealthResponseCache::ClusterHealthResponseCache(
+    Upstream::ClusterManager& cluster_manager,
+    ClusterMinHealthyPercentagesConstSharedPtr cluster_min_healthy_percentages)
+    : cluster_manager_(cluster_manager),
+      cluster_min_healthy_percentages_(std::move(cluster_min_healthy_percentages)),
+      cluster_update_callbacks_handle_(
+          cluster_manager_.addThreadLocalClusterUpdateCallbacks(*this)) {}
+
+const ClusterHealthResponse& ClusterHealthResponseCache::response() {
+  if (stale_) {
+    response_ = computeClusterHealthResponse(cluster_manager_, *cluster_min_healthy_percentages_);
+    stale_ = false;
+  }
+  return response_;
+}
+
+void ClusterHealthResponseCache::onClusterAddOrUpdate(Upstream::ThreadLocalCluster& cluster) {
+  if (cluster_min_healthy_percentages_->count(cluster.info()->name()) > 0) {
+    stale_ = true;
+  }
+}
+
+void ClusterHealthResponseCache::onClusterRemoval(const std::string& cluster_name) {
+  if (cluster_min_healthy_percentages_->count(cluster_name) > 0) {
+    stale_ = true;
+  }
+}
+
+ClusterHealthResponseCacheManager::ClusterHealthResponseCacheManager(
+    ThreadLocal::SlotAllocator& tls, Upstream::ClusterManager& cluster_manager,
+    ClusterMinHealthyPercentagesConstSharedPtr cluster_min_healthy_percentages)
+    : cluster_manager_(cluster_manager),
+      cluster_min_healthy_percentages_(std::move(cluster_min_healthy_percentages)),
+      slot_(ThreadLocal::TypedSlot<ClusterHealthResponseCache>::makeUnique(tls)) {
+  slot_->set([&cluster_manager = cluster_manager_,
+              cluster_min_healthy_percentages = cluster_min_healthy_percentages_](
+                 Event::Dispatcher&) {
+    return std::make_shared<ClusterHealthResponseCache>(cluster_manager,
+                                                        cluster_min_healthy_percentages);
+  });
+  cluster_update_callbacks_handle_ = cluster_manager_.addThreadLocalClusterUpdateCallbacks(*this);
+  for (const auto& item : *cluster_min_healthy_percentages_) {
+    watchCluster(item.first);
+  }
+}
+
+void ClusterHealthResponseCacheManager::onClusterAddOrUpdate(
+    Upstream::ThreadLocalCluster& cluster) {
+  const std::string& cluster_name = cluster.info()->name();
+  if (cluster_min_healthy_percentages_->count(cluster_name) > 0) {
+    watchCluster(cluster_name);
+  }
+}
+
+void ClusterHealthResponseCacheManager::onClusterRemoval(const std::string& cluster_name) {
+  priority_update_handles_.erase(cluster_name);
+}
+
+void ClusterHealthResponseCacheManager::watchCluster(const std::string& cluster_name) {
+  Upstream::ClusterConstOptRef cluster = cluster_manager_.clusters().getCluster(cluster_name);
+  if (!cluster.has_value()) {
+    priority_update_handles_.erase(cluster_name);
+    return;
+  }
+  // This callback is registered after the cluster's own priority update callback, which updates
+  // the membership stats, so the stats are current when the caches are invalidated.
+  priority_update_handles_[cluster_name] = cluster->get().prioritySet().addPriorityUpdateCb(
+      [this](uint32_t, const Upstream::HostVector&, const Upstream::HostVector&) {
+        slot_->runOnAllThreads([](OptRef<ClusterHealthResponseCache> cache) {
+          if (cache.has_value()) {
+            cache->invalidate();
+          }
+        });
+      });
+}
+
 Http::FilterHeadersStatus HealthCheckFilter::decodeHeaders(Http::RequestHeaderMap& headers,
                                                            bool end_stream) {
   if (Http::HeaderUtility::matchHeaders(headers, *header_match_data_)) {
@@ -132,41 +242,13 @@ void HealthCheckFilter::onComplete() {
     } else if (cluster_min_healthy_percentages_ != nullptr &&
                !cluster_min_healthy_percentages_->empty()) {
       // Check the status of the specified upstream cluster(s) to determine the right response.
-      auto& clusterManager = context_.clusterManager();
-      for (const auto& item : *cluster_min_healthy_percentages_) {
-        details = &RcDetails::get().HealthCheckClusterHealthy;
-        const std::string& cluster_name = item.first;
-        const uint64_t min_healthy_percentage = static_cast<uint64_t>(item.second);
-        auto* cluster = clusterManager.getThreadLocalCluster(cluster_name);
-        if (cluster == nullptr) {
-          // If the cluster does not exist at all, consider the service unhealthy.
-          final_status = Http::Code::ServiceUnavailable;
-          details = &RcDetails::get().HealthCheckNoCluster;
-
-          break;
-        }
-        const auto& stats = cluster->info()->stats();
-        const uint64_t membership_total = stats.membership_total_.value();
-        if (membership_total == 0) {
-          // If the cluster exists but is empty, consider the service unhealthy unless
-          // the specified minimum percent healthy for the cluster happens to be zero.
-          if (min_healthy_percentage == 0UL) {
-            continue;
-          } else {
-            final_status = Http::Code::ServiceUnavailable;
-            details = &RcDetails::get().HealthCheckClusterEmpty;
-            break;
-          }
-        }
-        // In the general case, consider the service unhealthy if fewer than the
-        // specified percentage of the servers in the cluster are available (healthy + degraded).
-        if ((100UL * (stats.membership_healthy_.value() + stats.membership_degraded_.value())) <
-            membership_total * min_healthy_percentage) {
-          final_status = Http::Code::ServiceUnavailable;
-          details = &RcDetails::get().HealthCheckClusterUnhealthy;
-          break;
-        }
-      }
+      const ClusterHealthResponse response =
+          cluster_health_cache_ != nullptr
+              ? cluster_health_cache_->response()
+              : computeClusterHealthResponse(context_.clusterManager(),
+                                             *cluster_min_healthy_percentages_);
+      final_status = response.code_;
+      details = response.details_;
     }
 
     if (!Http::CodeUtility::is2xx(enumToInt(final_status))) {
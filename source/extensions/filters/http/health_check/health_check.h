@@ -8,9 +8,13 @@
 #include "envoy/http/codes.h"
 #include "envoy/http/filter.h"
 #include "envoy/server/filter_config.h"
+#include "envoy/thread_local/thread_local.h"
+#include "envoy/upstream/cluster_manager.h"
 
 #include "source/common/http/header_utility.h"
 
+#include "absl/container/flat_hash_map.h"
+
 namespace Envoy {
 namespace Extensions {
 namespace HttpFilters {
@@ -55,6 +59,85 @@ using ClusterMinHealthyPercentagesConstSharedPtr =
 
 using HeaderDataVectorSharedPtr = std::shared_ptr<std::vector<Http::HeaderUtility::HeaderDataPtr>>;
 
+/**
+ * Response to a health check computed from the health of the configured upstream clusters.
+ */
+struct ClusterHealthResponse {
+  Http::Code code_;
+  // The response code details. This points to a static string.
+  const std::string* details_;
+};
+
+/**
+ * Computes the response to a health check from the membership of the given clusters.
+ */
+ClusterHealthResponse
+computeClusterHealthResponse(Upstream::ClusterManager& cluster_manager,
+                             const ClusterMinHealthyPercentages& cluster_min_healthy_percentages);
+
+/**
+ * Per-thread cache of the response computed from the health of the configured upstream clusters.
+ * The response is only recomputed after it has been invalidated, or after one of the clusters is
+ * added, updated or removed on this thread, so that frequent health checks do not look up every
+ * cluster on each request.
+ */
+class ClusterHealthResponseCache : public ThreadLocal::ThreadLocalObject,
+                                   public Upstream::ClusterUpdateCallbacks {
+public:
+  ClusterHealthResponseCache(
+      Upstream::ClusterManager& cluster_manager,
+      ClusterMinHealthyPercentagesConstSharedPtr cluster_min_healthy_percentages);
+
+  const ClusterHealthResponse& response();
+  void invalidate() { stale_ = true; }
+
+  // Upstream::ClusterUpdateCallbacks
+  void onClusterAddOrUpdate(Upstream::ThreadLocalCluster& cluster) override;
+  void onClusterRemoval(const std::string& cluster_name) override;
+
+private:
+  Upstream::ClusterManager& cluster_manager_;
+  const ClusterMinHealthyPercentagesConstSharedPtr cluster_min_healthy_percentages_;
+  Upstream::ClusterUpdateCallbacksHandlePtr cluster_update_callbacks_handle_;
+  ClusterHealthResponse response_{};
+  bool stale_{true};
+};
+
+/**
+ * Owns the per-thread cluster health response caches, and invalidates them on every thread when the
+ * hosts or their health change in one of the configured clusters. The changes are watched on the
+ * main thread, where the membership stats used to compute the response are updated right away,
+ * while the thread local clusters may only be updated once the cluster's update_merge_window
+ * expires.
+ */
+class ClusterHealthResponseCacheManager : public Upstream::ClusterUpdateCallbacks {
+public:
+  ClusterHealthResponseCacheManager(
+      ThreadLocal::SlotAllocator& tls, Upstream::ClusterManager& cluster_manager,
+      ClusterMinHealthyPercentagesConstSharedPtr cluster_min_healthy_percentages);
+
+  /**
+   * @return the cached response of the calling thread.
+   */
+  const ClusterHealthResponse& response() { return (*slot_)->response(); }
+
+  // Upstream::ClusterUpdateCallbacks
+  void onClusterAddOrUpdate(Upstream::ThreadLocalCluster& cluster) override;
+  void onClusterRemoval(const std::string& cluster_name) override;
+
+private:
+  void watchCluster(const std::string& cluster_name);
+
+  Upstream::ClusterManager& cluster_manager_;
+  const ClusterMinHealthyPercentagesConstSharedPtr cluster_min_healthy_percentages_;
+  ThreadLocal::TypedSlotPtr<ClusterHealthResponseCache> slot_;
+  Upstream::ClusterUpdateCallbacksHandlePtr cluster_update_callbacks_handle_;
+  absl::flat_hash_map<std::string, Common::CallbackHandlePtr> priority_update_handles_;
+};
+
+using ClusterHealthResponseCacheManagerSharedPtr =
+    std::shared_ptr<ClusterHealthResponseCacheManager>;
+
 /**
  * Health check responder filter.
  */
@@ -63,10 +146,12 @@ public:
   HealthCheckFilter(Server::Configuration::FactoryContext& context, bool pass_through_mode,
                     HealthCheckCacheManagerSharedPtr cache_manager,
                     HeaderDataVectorSharedPtr header_match_data,
-                    ClusterMinHealthyPercentagesConstSharedPtr cluster_min_healthy_percentages)
+                    ClusterMinHealthyPercentagesConstSharedPtr cluster_min_healthy_percentages,
+                    ClusterHealthResponseCacheManagerSharedPtr cluster_health_cache = nullptr)
       : context_(context), pass_through_mode_(pass_through_mode), cache_manager_(cache_manager),
         header_match_data_(std::move(header_match_data)),
-        cluster_min_healthy_percentages_(cluster_min_healthy_percentages) {}
+        cluster_min_healthy_percentages_(cluster_min_healthy_percentages),
+        cluster_health_cache_(std::move(cluster_health_cache)) {}
 
   // Http::StreamFilterBase
   void onDestroy() override {}
@@ -108,6 +193,7 @@ private:
   HealthCheckCacheManagerSharedPtr cache_manager_;
   const HeaderDataVectorSharedPtr header_match_data_;
   ClusterMinHealthyPercentagesConstSharedPtr cluster_min_healthy_percentages_;
+  ClusterHealthResponseCacheManagerSharedPtr cluster_health_cache_;
 };
 
 } // namespace HealthCheck
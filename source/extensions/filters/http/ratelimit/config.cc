@@ -28,11 +28,12 @@ Http::FilterFactoryCb RateLimitFilterConfig::createFilterFactoryFromProtoTyped(
       std::chrono::milliseconds(PROTOBUF_GET_MS_OR_DEFAULT(proto_config, timeout, 20));
 
   Config::Utility::checkTransportVersion(proto_config.rate_limit_service());
-  return [proto_config, &context, timeout,
-          filter_config](Http::FilterChainFactoryCallbacks& callbacks) -> void {
-    callbacks.addStreamFilter(std::make_shared<Filter>(
-        filter_config, Filters::Common::RateLimit::rateLimitClient(
-                           context, proto_config.rate_limit_service().grpc_service(), timeout)));
+  auto client_factory = std::make_shared<const Filter::ClientFactory>(
+      [&context, grpc_service = proto_config.rate_limit_service().grpc_service(), timeout]() {
+        return Filters::Common::RateLimit::rateLimitClient(context, grpc_service, timeout);
+      });
+  return [client_factory, filter_config](Http::FilterChainFactoryCallbacks& callbacks) -> void {
+    callbacks.addStreamFilter(std::make_shared<Filter>(filter_config, client_factory));
   };
 }
 
@@ -69,6 +69,10 @@ void Filter::initiateCall(const Http::RequestHeaderMap& headers) {
   }
 
   if (!descriptors.empty()) {
+    if (client_ == nullptr) {
+      ASSERT(client_factory_ != nullptr);
+      client_ = (*client_factory_)();
+    }
     state_ = State::Calling;
     initiating_call_ = true;
     client_->limit(*this, config_->domain(), descriptors, callbacks_->activeSpan(),
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -121,8 +122,15 @@ private:
  */
 class Filter : public Http::StreamFilter, public Filters::Common::RateLimit::RequestCallbacks {
 public:
+  using ClientFactory = std::function<Filters::Common::RateLimit::ClientPtr()>;
+  using ClientFactorySharedPtr = std::shared_ptr<const ClientFactory>;
+
   Filter(FilterConfigSharedPtr config, Filters::Common::RateLimit::ClientPtr&& client)
       : config_(config), client_(std::move(client)) {}
+  // The client is only created once the filter actually calls the rate limit service, so streams
+  // without applicable rate limit descriptors do not pay for the client lookup and allocation.
+  Filter(FilterConfigSharedPtr config, ClientFactorySharedPtr client_factory)
+      : config_(config), client_factory_(std::move(client_factory)) {}
 
   // Http::StreamFilterBase
   void onDestroy() override;
@@ -166,6 +174,7 @@ private:
 
   FilterConfigSharedPtr config_;
   Filters::Common::RateLimit::ClientPtr client_;
+  const ClientFactorySharedPtr client_factory_;
   Http::StreamDecoderFilterCallbacks* callbacks_{};
   State state_{State::NotStarted};
   VhRateLimitOptions vh_rate_limits_;
@@ -22,7 +22,6 @@ Config::Config(Stats::Scope& scope)
     : stats_{ALL_HTTP_INSPECTOR_STATS(POOL_COUNTER_PREFIX(scope, "http_inspector."))} {}
 
 const absl::string_view Filter::HTTP2_CONNECTION_PREFACE = "PRI * HTTP/2.0\r\n\r\nSM\r\n\r\n";
-thread_local uint8_t Filter::buf_[Config::MAX_INSPECT_SIZE];
 
 Filter::Filter(const ConfigSharedPtr config) : config_(config) {
   http_parser_init(&parser_, HTTP_REQUEST);
@@ -62,6 +61,7 @@ Network::FilterStatus Filter::onAccept(Network::ListenerFilterCallbacks& cb) {
         [this](uint32_t events) {
           ENVOY_LOG(trace, "http inspector event: {}", events);
 
+          cb_->listenerFilterBuffer().onSocketReadable();
           const ParseState parse_state = onRead();
           switch (parse_state) {
           case ParseState::Error:
@@ -85,7 +85,9 @@ Network::FilterStatus Filter::onAccept(Network::ListenerFilterCallbacks& cb) {
 }
 
 ParseState Filter::onRead() {
-  auto result = cb_->socket().ioHandle().recv(buf_, Config::MAX_INSPECT_SIZE, MSG_PEEK);
+  // The data may already have been peeked at by a listener filter that ran before this one.
+  Network::ListenerFilterBuffer& buffer = cb_->listenerFilterBuffer();
+  auto result = buffer.peek(Config::MAX_INSPECT_SIZE);
   ENVOY_LOG(trace, "http inspector: recv: {}", result.return_value_);
   if (!result.ok()) {
     if (result.err_->getErrorCode() == Api::IoError::IoErrorCode::Again) {
@@ -100,8 +102,7 @@ ParseState Filter::onRead() {
     return ParseState::Error;
   }
 
-  const auto parse_state =
-      parseHttpHeader(absl::string_view(reinterpret_cast<const char*>(buf_), result.return_value_));
+  const auto parse_state = parseHttpHeader(buffer.peekedData().substr(0, result.return_value_));
   switch (parse_state) {
   case ParseState::Continue:
     // do nothing but wait for the next event
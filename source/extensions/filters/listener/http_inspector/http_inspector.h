@@ -85,9 +85,6 @@ private:
   absl::string_view protocol_;
   http_parser parser_;
   static http_parser_settings settings_;
-
-  // Use static thread_local to avoid allocating buffer over and over again.
-  static thread_local uint8_t buf_[Config::MAX_INSPECT_SIZE];
 };
 
 } // namespace HttpInspector
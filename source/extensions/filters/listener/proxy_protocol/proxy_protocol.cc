@@ -70,6 +70,7 @@ Network::FilterStatus Filter::onAccept(Network::ListenerFilterCallbacks& cb) {
       cb.dispatcher(),
       [this](uint32_t events) {
         ASSERT(events == Event::FileReadyType::Read);
+        cb_->listenerFilterBuffer().onSocketReadable();
         onRead();
       },
       Event::PlatformDefaultTriggerType, Event::FileReadyType::Read);
@@ -93,13 +94,13 @@ ReadOrParseState Filter::onReadWorker() {
   // data. In cases a) and b) we'll be called again when the socket is ready to read and pick up
   // where we left off.
   if (!proxy_protocol_header_.has_value()) {
-    const ReadOrParseState read_header_state = readProxyHeader(socket.ioHandle());
+    const ReadOrParseState read_header_state = readProxyHeader(cb_->listenerFilterBuffer());
     if (read_header_state != ReadOrParseState::Done) {
       return read_header_state;
     }
   }
   if (proxy_protocol_header_.has_value()) {
-    const ReadOrParseState read_ext_state = readExtensions(socket.ioHandle());
+    const ReadOrParseState read_ext_state = readExtensions(cb_->listenerFilterBuffer());
     if (read_ext_state != ReadOrParseState::Done) {
       return read_ext_state;
     }
@@ -299,14 +300,14 @@ bool Filter::parseV1Header(char* buf, size_t len) {
   return true;
 }
 
-ReadOrParseState Filter::parseExtensions(Network::IoHandle& io_handle, uint8_t* buf,
+ReadOrParseState Filter::parseExtensions(Network::ListenerFilterBuffer& buffer, uint8_t* buf,
                                          size_t buf_size, size_t* buf_off) {
   // If we ever implement extensions elsewhere, be sure to
   // continue to skip and ignore those for LOCAL.
   while (proxy_protocol_header_.value().extensions_length_) {
     int to_read = std::min(buf_size, proxy_protocol_header_.value().extensions_length_);
     buf += (nullptr != buf_off) ? *buf_off : 0;
-    const auto recv_result = io_handle.recv(buf, to_read, 0);
+    const auto recv_result = buffer.read(buf, to_read);
     if (!recv_result.ok()) {
       if (recv_result.err_->getErrorCode() == Api::IoError::IoErrorCode::Again) {
         return ReadOrParseState::TryAgainLater;
@@ -390,12 +391,12 @@ bool Filter::parseTlvs(const std::vector<uint8_t>& tlvs) {
   return true;
 }
 
-ReadOrParseState Filter::readExtensions(Network::IoHandle& io_handle) {
+ReadOrParseState Filter::readExtensions(Network::ListenerFilterBuffer& buffer) {
   // Parse and discard the extensions if this is a local command or there's no TLV needs to be saved
   // to metadata.
   if (proxy_protocol_header_.value().local_command_ || 0 == config_->numberOfNeededTlvTypes()) {
     // buf_ is no longer in use so we re-use it to read/discard.
-    return parseExtensions(io_handle, reinterpret_cast<uint8_t*>(buf_), sizeof(buf_), nullptr);
+    return parseExtensions(buffer, reinterpret_cast<uint8_t*>(buf_), sizeof(buf_), nullptr);
   }
 
   // Initialize the buf_tlv_ only when we need to read the TLVs.
@@ -405,7 +406,7 @@ ReadOrParseState Filter::readExtensions(Network::IoHandle& io_handle) {
 
   // Parse until we have all the TLVs in buf_tlv.
   const ReadOrParseState parse_extensions_state =
-      parseExtensions(io_handle, buf_tlv_.data(), buf_tlv_.size(), &buf_tlv_off_);
+      parseExtensions(buffer, buf_tlv_.data(), buf_tlv_.size(), &buf_tlv_off_);
   if (parse_extensions_state != ReadOrParseState::Done) {
     return parse_extensions_state;
   }
@@ -417,10 +418,9 @@ ReadOrParseState Filter::readExtensions(Network::IoHandle& io_handle) {
   return ReadOrParseState::Done;
 }
 
-ReadOrParseState Filter::readProxyHeader(Network::IoHandle& io_handle) {
+ReadOrParseState Filter::readProxyHeader(Network::ListenerFilterBuffer& buffer) {
   while (buf_off_ < MAX_PROXY_PROTO_LEN_V2) {
-    const auto result =
-        io_handle.recv(buf_ + buf_off_, MAX_PROXY_PROTO_LEN_V2 - buf_off_, MSG_PEEK);
+    const auto result = buffer.peek(MAX_PROXY_PROTO_LEN_V2 - buf_off_);
 
     if (!result.ok()) {
       if (result.err_->getErrorCode() == Api::IoError::IoErrorCode::Again) {
@@ -435,6 +435,7 @@ ReadOrParseState Filter::readProxyHeader(Network::IoHandle& io_handle) {
       ENVOY_LOG(debug, "failed to read proxy protocol (no bytes read)");
       return ReadOrParseState::Error;
     }
+    memcpy(buf_ + buf_off_, buffer.peekedData().data(), nread); // NOLINT(safe-memcpy)
 
     if (buf_off_ + nread >= PROXY_PROTO_V2_HEADER_LEN) {
       const char* sig = PROXY_PROTO_V2_SIGNATURE;
@@ -455,7 +456,7 @@ ReadOrParseState Filter::readProxyHeader(Network::IoHandle& io_handle) {
       }
       if (buf_off_ < PROXY_PROTO_V2_HEADER_LEN) {
         ssize_t exp = PROXY_PROTO_V2_HEADER_LEN - buf_off_;
-        const auto read_result = io_handle.recv(buf_ + buf_off_, exp, 0);
+        const auto read_result = buffer.read(buf_ + buf_off_, exp);
         if (!read_result.ok() || read_result.return_value_ != uint64_t(exp)) {
           ENVOY_LOG(debug, "failed to read proxy protocol (remote closed)");
           return ReadOrParseState::Error;
@@ -477,7 +478,7 @@ ReadOrParseState Filter::readProxyHeader(Network::IoHandle& io_handle) {
       }
       if (ssize_t(buf_off_) + nread >= PROXY_PROTO_V2_HEADER_LEN + addr_len) {
         ssize_t missing = (PROXY_PROTO_V2_HEADER_LEN + addr_len) - buf_off_;
-        const auto read_result = io_handle.recv(buf_ + buf_off_, missing, 0);
+        const auto read_result = buffer.read(buf_ + buf_off_, missing);
         if (!read_result.ok() || read_result.return_value_ != uint64_t(missing)) {
           ENVOY_LOG(debug, "failed to read proxy protocol (remote closed)");
           return ReadOrParseState::Error;
@@ -491,7 +492,7 @@ ReadOrParseState Filter::readProxyHeader(Network::IoHandle& io_handle) {
           return ReadOrParseState::Error;
         }
       } else if (nread != 0) {
-        const auto result = io_handle.recv(buf_ + buf_off_, nread, 0);
+        const auto result = buffer.read(buf_ + buf_off_, nread);
         nread = result.return_value_;
         if (!result.ok()) {
           ENVOY_LOG(debug, "failed to read proxy protocol (remote closed)");
@@ -525,7 +526,7 @@ ReadOrParseState Filter::readProxyHeader(Network::IoHandle& io_handle) {
         ntoread = search_index_ - buf_off_;
       }
 
-      const auto result = io_handle.recv(buf_ + buf_off_, ntoread, 0);
+      const auto result = buffer.read(buf_ + buf_off_, ntoread);
       nread = result.return_value_;
       ASSERT(result.ok() && size_t(nread) == ntoread);
 
@@ -100,15 +100,15 @@ private:
    * (delimited by \r\n if V1 format, or with length if V2)
    * @return bool true valid header, false if more data is needed or socket errors occurred.
    */
-  ReadOrParseState readProxyHeader(Network::IoHandle& io_handle);
+  ReadOrParseState readProxyHeader(Network::ListenerFilterBuffer& buffer);
 
   /**
    * Parse (and discard unknown) header extensions (until hdr.extensions_length == 0)
    */
-  ReadOrParseState parseExtensions(Network::IoHandle& io_handle, uint8_t* buf, size_t buf_size,
-                                   size_t* buf_off = nullptr);
+  ReadOrParseState parseExtensions(Network::ListenerFilterBuffer& buffer, uint8_t* buf,
+                                   size_t buf_size, size_t* buf_off = nullptr);
   bool parseTlvs(const std::vector<uint8_t>& tlvs);
-  ReadOrParseState readExtensions(Network::IoHandle& io_handle);
+  ReadOrParseState readExtensions(Network::ListenerFilterBuffer& buffer);
 
   /**
    * Given a char * & len, parse the header as per spec.
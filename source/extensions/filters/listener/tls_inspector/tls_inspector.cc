@@ -75,11 +75,7 @@ Config::Config(
 
 bssl::UniquePtr<SSL> Config::newSsl() { return bssl::UniquePtr<SSL>{SSL_new(ssl_ctx_.get())}; }
 
-thread_local uint8_t Filter::buf_[Config::TLS_MAX_CLIENT_HELLO];
-
 Filter::Filter(const ConfigSharedPtr config) : config_(config), ssl_(config_->newSsl()) {
-  RELEASE_ASSERT(sizeof(buf_) >= config_->maxClientHelloSize(), "");
-
   SSL_set_app_data(ssl_.get(), this);
   SSL_set_accept_state(ssl_.get());
 }
@@ -105,6 +101,7 @@ Network::FilterStatus Filter::onAccept(Network::ListenerFilterCallbacks& cb) {
         cb.dispatcher(),
         [this](uint32_t events) {
           ASSERT(events == Event::FileReadyType::Read);
+          cb_->listenerFilterBuffer().onSocketReadable();
           ParseState parse_state = onRead();
           switch (parse_state) {
           case ParseState::Error:
@@ -159,7 +156,8 @@ void Filter::onServername(absl::string_view name) {
 ParseState Filter::onRead() {
   // This receive code is somewhat complicated, because it must be done as a MSG_PEEK because
   // there is no way for a listener-filter to pass payload data to the ConnectionImpl and filters
-  // that get created later.
+  // that get created later. The peeked data is shared with the other listener filters of the
+  // connection, so the socket is only peeked at again once it has become readable.
   //
   // We request from the file descriptor to get events every time new data is available,
   // even if previous data has not been read, which is always the case due to MSG_PEEK. When
@@ -169,7 +167,8 @@ ParseState Filter::onRead() {
   //
   // TODO(ggreenway): write an integration test to ensure the events work as expected on all
   // platforms.
-  const auto result = cb_->socket().ioHandle().recv(buf_, config_->maxClientHelloSize(), MSG_PEEK);
+  Network::ListenerFilterBuffer& buffer = cb_->listenerFilterBuffer();
+  const auto result = buffer.peek(config_->maxClientHelloSize());
   ENVOY_LOG(trace, "tls inspector: recv: {}", result.return_value_);
 
   if (!result.ok()) {
@@ -188,7 +187,7 @@ ParseState Filter::onRead() {
   // Because we're doing a MSG_PEEK, data we've seen before gets returned every time, so
   // skip over what we've already processed.
   if (static_cast<uint64_t>(result.return_value_) > read_) {
-    const uint8_t* data = buf_ + read_;
+    const uint8_t* data = reinterpret_cast<const uint8_t*>(buffer.peekedData().data()) + read_;
     const size_t len = result.return_value_ - read_;
     read_ = result.return_value_;
     return parseClientHello(data, len);
@@ -106,16 +106,16 @@ Api::IoCallUint64Result IoHandleImpl::readv(uint64_t max_length, Buffer::RawSlic
   // The read bytes can not exceed the provided buffer size or pending received size.
   const auto max_bytes_to_read = std::min(pending_received_data_.length(), max_length);
   uint64_t bytes_offset = 0;
-  for (uint64_t i = 0; i < num_slice && bytes_offset < max_length; i++) {
+  for (uint64_t i = 0; i < num_slice && bytes_offset < max_bytes_to_read; i++) {
     auto bytes_to_read_in_this_slice =
         std::min(max_bytes_to_read - bytes_offset, uint64_t(slices[i].len_));
-    // Copy and drain, so pending_received_data_ always copy from offset 0.
-    pending_received_data_.copyOut(0, bytes_to_read_in_this_slice, slices[i].mem_);
-    pending_received_data_.drain(bytes_to_read_in_this_slice);
+    pending_received_data_.copyOut(bytes_offset, bytes_to_read_in_this_slice, slices[i].mem_);
     bytes_offset += bytes_to_read_in_this_slice;
   }
   const auto bytes_read = bytes_offset;
   ASSERT(bytes_read <= max_bytes_to_read);
+  // Drain once after copying so that the watermark callbacks fire at most once per read.
+  pending_received_data_.drain(bytes_read);
   ENVOY_LOG(trace, "socket {} readv {} bytes", static_cast<void*>(this), bytes_read);
   return {bytes_read, Api::IoErrorPtr(nullptr, Network::IoSocketError::deleteIoError)};
 }
@@ -4,7 +4,6 @@
 #include "envoy/tracing/http_tracer.h"
 
 #include "source/common/common/random_generator.h"
-#include "source/common/common/utility.h"
 
 namespace Envoy {
 namespace Extensions {
@@ -33,14 +32,27 @@ UUIDRequestIDExtension::toInteger(const Http::RequestHeaderMap& request_headers)
   if (request_headers.RequestId() == nullptr) {
     return absl::nullopt;
   }
-  const std::string uuid(request_headers.getRequestIdValue());
+  const absl::string_view uuid = request_headers.getRequestIdValue();
   if (uuid.length() < 8) {
     return absl::nullopt;
   }
 
-  uint64_t value;
-  if (!StringUtil::atoull(uuid.substr(0, 8).c_str(), value, 16)) {
-    return absl::nullopt;
+  // Parse the leading 8 hex digits in place. This runs for every sampled request, so avoid
+  // copying the header value.
+  uint64_t value = 0;
+  for (size_t i = 0; i < 8; ++i) {
+    const char c = uuid[i];
+    uint64_t digit;
+    if (c >= '0' && c <= '9') {
+      digit = c - '0';
+    } else if (c >= 'a' && c <= 'f') {
+      digit = c - 'a' + 10;
+    } else if (c >= 'A' && c <= 'F') {
+      digit = c - 'A' + 10;
+    } else {
+      return absl::nullopt;
+    }
+    value = (value << 4) | digit;
   }
 
   return value;
@@ -77,24 +89,30 @@ void UUIDRequestIDExtension::setTraceReason(Http::RequestHeaderMap& request_head
   if (uuid_view.length() != Random::RandomGeneratorImpl::UUID_LENGTH) {
     return;
   }
-  std::string uuid(uuid_view);
 
+  char trace_byte;
   switch (reason) {
   case Tracing::Reason::ServiceForced:
-    uuid[TRACE_BYTE_POSITION] = TRACE_FORCED;
+    trace_byte = TRACE_FORCED;
     break;
   case Tracing::Reason::ClientForced:
-    uuid[TRACE_BYTE_POSITION] = TRACE_CLIENT;
+    trace_byte = TRACE_CLIENT;
     break;
   case Tracing::Reason::Sampling:
-    uuid[TRACE_BYTE_POSITION] = TRACE_SAMPLED;
+    trace_byte = TRACE_SAMPLED;
     break;
   case Tracing::Reason::NotTraceable:
-    uuid[TRACE_BYTE_POSITION] = NO_TRACE;
+    trace_byte = NO_TRACE;
     break;
   default:
-    break;
+    return;
   }
+  // The reason is re-applied on every hop, so skip rewriting the header when it is already packed.
+  if (uuid_view[TRACE_BYTE_POSITION] == trace_byte) {
+    return;
+  }
+  std::string uuid(uuid_view);
+  uuid[TRACE_BYTE_POSITION] = trace_byte;
   request_headers.setRequestId(uuid);
 }
 
@@ -21,7 +21,7 @@
 #include "source/common/network/utility.h"
 #include "source/common/stats/symbol_table_impl.h"
 
-#include "absl/strings/str_join.h"
+#include "absl/strings/str_cat.h"
 
 namespace Envoy {
 namespace Extensions {
@@ -59,18 +59,22 @@ UdpStatsdSink::UdpStatsdSink(ThreadLocal::SlotAllocator& tls,
 void UdpStatsdSink::flush(Stats::MetricSnapshot& snapshot) {
   Writer& writer = tls_->getTyped<Writer>();
   Buffer::OwnedImpl buffer;
+  // Reused for every metric so that its capacity is only grown a handful of times per flush.
+  std::string message;
 
   for (const auto& counter : snapshot.counters()) {
     if (counter.counter_.get().used()) {
-      const std::string counter_str = buildMessage(counter.counter_.get(), counter.delta_, "|c");
-      writeBuffer(buffer, writer, counter_str);
+      message.clear();
+      appendMessage(message, counter.counter_.get(), counter.delta_, "|c");
+      writeBuffer(buffer, writer, message);
     }
   }
 
   for (const auto& gauge : snapshot.gauges()) {
     if (gauge.get().used()) {
-      const std::string gauge_str = buildMessage(gauge.get(), gauge.get().value(), "|g");
-      writeBuffer(buffer, writer, gauge_str);
+      message.clear();
+      appendMessage(message, gauge.get(), gauge.get().value(), "|g");
+      writeBuffer(buffer, writer, message);
     }
   }
 
@@ -128,29 +132,30 @@ void UdpStatsdSink::onHistogramComplete(const Stats::Histogram& histogram, uint6
 
 template <typename ValueType>
 const std::string UdpStatsdSink::buildMessage(const Stats::Metric& metric, ValueType value,
-                                              const std::string& type) const {
-  switch (tag_format_.tag_position) {
-  case Statsd::TagPosition::TagAfterValue: {
-    const std::string message = absl::StrCat(
-        // metric name
-        prefix_, ".", getName(metric),
-        // value and type
-        ":", value, type,
-        // tags
-        buildTagStr(metric.tags()));
-    return message;
-  }
+                                              absl::string_view type) const {
+  std::string message;
+  appendMessage(message, metric, value, type);
+  return message;
+}
 
-  case Statsd::TagPosition::TagAfterName: {
-    const std::string message = absl::StrCat(
-        // metric name
-        prefix_, ".", getName(metric),
-        // tags
-        buildTagStr(metric.tags()),
-        // value and type
-        ":", value, type);
-    return message;
-  }
+template <typename ValueType>
+void UdpStatsdSink::appendMessage(std::string& message, const Stats::Metric& metric,
+                                  ValueType value, absl::string_view type) const {
+  // metric name
+  absl::StrAppend(&message, prefix_, ".", getName(metric));
+  switch (tag_format_.tag_position) {
+  case Statsd::TagPosition::TagAfterValue:
+    // value and type
+    absl::StrAppend(&message, ":", value, type);
+    // tags
+    appendTagStr(message, metric.tags());
+    return;
+  case Statsd::TagPosition::TagAfterName:
+    // tags
+    appendTagStr(message, metric.tags());
+    // value and type
+    absl::StrAppend(&message, ":", value, type);
+    return;
   }
   NOT_REACHED_GCOVR_EXCL_LINE;
 }
@@ -163,17 +168,21 @@ const std::string UdpStatsdSink::getName(const Stats::Metric& metric) const {
   }
 }
 
-const std::string UdpStatsdSink::buildTagStr(const std::vector<Stats::Tag>& tags) const {
+void UdpStatsdSink::appendTagStr(std::string& message,
+                                 const std::vector<Stats::Tag>& tags) const {
   if (!use_tag_ || tags.empty()) {
-    return "";
+    return;
   }
 
-  std::vector<std::string> tag_strings;
-  tag_strings.reserve(tags.size());
+  absl::StrAppend(&message, tag_format_.start);
+  bool first = true;
   for (const Stats::Tag& tag : tags) {
-    tag_strings.emplace_back(tag.name_ + tag_format_.assign + tag.value_);
+    if (!first) {
+      absl::StrAppend(&message, tag_format_.separator);
+    }
+    first = false;
+    absl::StrAppend(&message, tag.name_, tag_format_.assign, tag.value_);
   }
-  return tag_format_.start + absl::StrJoin(tag_strings, tag_format_.separator);
 }
 
 TcpStatsdSink::TcpStatsdSink(const LocalInfo::LocalInfo& local_info,
@@ -17,6 +17,7 @@
 #include "source/common/network/io_socket_handle_impl.h"
 #include "source/extensions/stat_sinks/common/statsd/tag_formats.h"
 
+#include "absl/strings/string_view.h"
 #include "absl/types/optional.h"
 
 namespace Envoy {
@@ -87,9 +88,14 @@ private:
 
   template <typename ValueType>
   const std::string buildMessage(const Stats::Metric& metric, ValueType value,
-                                 const std::string& type) const;
+                                 absl::string_view type) const;
+  // Appends the statsd line for the metric to message. This lets flush() reuse a single string
+  // for every metric rather than allocating a message (and its tag strings) per metric.
+  template <typename ValueType>
+  void appendMessage(std::string& message, const Stats::Metric& metric, ValueType value,
+                     absl::string_view type) const;
   const std::string getName(const Stats::Metric& metric) const;
-  const std::string buildTagStr(const std::vector<Stats::Tag>& tags) const;
+  void appendTagStr(std::string& message, const std::vector<Stats::Tag>& tags) const;
 
   const ThreadLocal::SlotPtr tls_;
   const Network::Address::InstanceConstSharedPtr server_address_;
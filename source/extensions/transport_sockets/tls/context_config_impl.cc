@@ -382,6 +382,10 @@ const std::string ServerContextConfigImpl::DEFAULT_CURVES =
 #endif
     "P-256";
 
+const uint32_t ServerContextConfigImpl::DEFAULT_MAX_CACHED_CERTIFICATES = 4096;
+const std::chrono::milliseconds ServerContextConfigImpl::DEFAULT_NEGATIVE_CACHE_TTL =
+    std::chrono::seconds(30);
+
 ServerContextConfigImpl::ServerContextConfigImpl(
     const envoy::extensions::transport_sockets::tls::v3::DownstreamTlsContext& config,
     Server::Configuration::TransportSocketFactoryContext& factory_context)
@@ -434,6 +438,17 @@ void ServerContextConfigImpl::setSecretUpdateCallback(std::function<void()> call
   }
 }
 
+void ServerContextConfigImpl::setCertificateProvider(
+    Ssl::CertificateProviderSharedPtr provider, uint32_t max_cached_certificates,
+    std::chrono::milliseconds negative_cache_ttl) {
+  if (provider != nullptr && ocsp_staple_policy_ == OcspStaplePolicy::MustStaple) {
+    throw EnvoyException("A certificate provider cannot be used with the must-staple OCSP policy");
+  }
+  certificate_provider_ = std::move(provider);
+  max_cached_provided_certificates_ = max_cached_certificates;
+  provided_certificate_negative_cache_ttl_ = negative_cache_ttl;
+}
+
 std::vector<Ssl::ServerContextConfig::SessionTicketKey>
 ServerContextConfigImpl::getSessionTicketKeys(
     const envoy::extensions::transport_sockets::tls::v3::TlsSessionTicketKeys& keys) {
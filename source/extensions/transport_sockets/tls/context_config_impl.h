@@ -158,12 +158,35 @@ public:
   bool disableStatelessSessionResumption() const override {
     return disable_stateless_session_resumption_;
   }
+  Ssl::CertificateProviderSharedPtr certificateProvider() const override {
+    return certificate_provider_;
+  }
+  uint32_t maxCachedProvidedCertificates() const override {
+    return max_cached_provided_certificates_;
+  }
+  std::chrono::milliseconds providedCertificateNegativeCacheTtl() const override {
+    return provided_certificate_negative_cache_ttl_;
+  }
+
+  /**
+   * Install a provider that is asked for the certificate of each SNI at handshake time. Provided
+   * certificates are kept in an LRU cache of at most max_cached_certificates entries, shared by
+   * all of the workers. Server names the provider has no certificate for are kept in the same
+   * cache for negative_cache_ttl. There is no configuration or extension point that calls this
+   * yet, so the provider can only be installed programmatically.
+   */
+  void setCertificateProvider(
+      Ssl::CertificateProviderSharedPtr provider,
+      uint32_t max_cached_certificates = DEFAULT_MAX_CACHED_CERTIFICATES,
+      std::chrono::milliseconds negative_cache_ttl = DEFAULT_NEGATIVE_CACHE_TTL);
 
 private:
   static const unsigned DEFAULT_MIN_VERSION;
   static const unsigned DEFAULT_MAX_VERSION;
   static const std::string DEFAULT_CIPHER_SUITES;
   static const std::string DEFAULT_CURVES;
+  static const uint32_t DEFAULT_MAX_CACHED_CERTIFICATES;
+  static const std::chrono::milliseconds DEFAULT_NEGATIVE_CACHE_TTL;
 
   const bool require_client_certificate_;
   const OcspStaplePolicy ocsp_staple_policy_;
@@ -181,6 +204,9 @@ private:
 
   absl::optional<std::chrono::seconds> session_timeout_;
   const bool disable_stateless_session_resumption_;
+  Ssl::CertificateProviderSharedPtr certificate_provider_;
+  uint32_t max_cached_provided_certificates_{DEFAULT_MAX_CACHED_CERTIFICATES};
+  std::chrono::milliseconds provided_certificate_negative_cache_ttl_{DEFAULT_NEGATIVE_CACHE_TTL};
 };
 
 } // namespace Tls
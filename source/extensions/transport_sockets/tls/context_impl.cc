@@ -26,8 +26,10 @@
 #include "source/extensions/transport_sockets/tls/utility.h"
 
 #include "absl/container/node_hash_set.h"
+#include "absl/strings/ascii.h"
 #include "absl/strings/match.h"
 #include "absl/strings/str_join.h"
+#include "openssl/bytestring.h"
 #include "openssl/evp.h"
 #include "openssl/hmac.h"
 #include "openssl/pkcs12.h"
@@ -73,6 +75,14 @@ int ContextImpl::sslExtendedSocketInfoIndex() {
   }());
 }
 
+int ContextImpl::sslCertificateSelectionIndex() {
+  CONSTRUCT_ON_FIRST_USE(int, []() -> int {
+    int ssl_context_index = SSL_get_ex_new_index(0, nullptr, nullptr, nullptr, nullptr);
+    RELEASE_ASSERT(ssl_context_index >= 0, "");
+    return ssl_context_index;
+  }());
+}
+
 ContextImpl::ContextImpl(Stats::Scope& scope, const Envoy::Ssl::ContextConfig& config,
                          TimeSource& time_source)
     : scope_(scope), stats_(generateSslStats(scope)), time_source_(time_source),
@@ -651,7 +661,9 @@ ServerContextImpl::ServerContextImpl(Stats::Scope& scope,
                                      const std::vector<std::string>& server_names,
                                      TimeSource& time_source)
     : ContextImpl(scope, config, time_source), session_ticket_keys_(config.sessionTicketKeys()),
-      ocsp_staple_policy_(config.ocspStaplePolicy()) {
+      ocsp_staple_policy_(config.ocspStaplePolicy()),
+      provided_certificate_cache_(config.maxCachedProvidedCertificates(),
+                                  config.providedCertificateNegativeCacheTtl(), time_source) {
   if (config.tlsCertificates().empty() && !config.capabilities().provides_certificates) {
     throw EnvoyException("Server TlsCertificates must have a certificate specified");
   }
@@ -665,6 +677,9 @@ ServerContextImpl::ServerContextImpl(Stats::Scope& scope,
   // TODO(htuch): replace with SSL_IDENTITY when we have this as a means to do multi-cert in
   // BoringSSL.
   if (!config.capabilities().provides_certificates) {
+    // The certificate provider is consulted from the select certificate callback, so it is only
+    // used when the handshaker does not supply certificates itself.
+    certificate_provider_ = config.certificateProvider();
     SSL_CTX_set_select_certificate_cb(
         tls_contexts_[0].ssl_ctx_.get(),
         [](const SSL_CLIENT_HELLO* client_hello) -> ssl_select_cert_result_t {
@@ -1029,6 +1044,32 @@ OcspStapleAction ServerContextImpl::ocspStapleAction(const TlsContext& ctx,
 
 enum ssl_select_cert_result_t
 ServerContextImpl::selectTlsContext(const SSL_CLIENT_HELLO* ssl_client_hello) {
+  if (certificate_provider_ != nullptr) {
+    const auto provided_certificate = providedCertificate(ssl_client_hello);
+    if (!provided_certificate.has_value()) {
+      // Suspend the handshake until the certificate is fetched. SSL_do_handshake() fails with
+      // SSL_ERROR_PENDING_CERTIFICATE and this callback runs again when it is resumed.
+      return ssl_select_cert_retry;
+    }
+    if (provided_certificate.value() != nullptr) {
+      // The SSL instance keeps the settings of the first context, which the provided certificate
+      // and key replace. Provided certificates are never stapled.
+      const Ssl::ProvidedCertificate& certificate = *provided_certificate.value();
+      SSL* ssl = ssl_client_hello->ssl;
+      if (!SSL_use_certificate(ssl, certificate.cert_chain_.get()) ||
+          (certificate.intermediates_ != nullptr &&
+           !SSL_set1_chain(ssl, certificate.intermediates_.get())) ||
+          !SSL_use_PrivateKey(ssl, certificate.private_key_.get())) {
+        return ssl_select_cert_error;
+      }
+      if (isClientOcspCapable(ssl_client_hello)) {
+        stats_.ocsp_staple_requests_.inc();
+        stats_.ocsp_staple_omitted_.inc();
+      }
+      return ssl_select_cert_success;
+    }
+  }
+
   const bool client_ecdsa_capable = isClientEcdsaCapable(ssl_client_hello);
   const bool client_ocsp_capable = isClientOcspCapable(ssl_client_hello);
 
@@ -1083,6 +1124,115 @@ ServerContextImpl::selectTlsContext(const SSL_CLIENT_HELLO* ssl_client_hello) {
   return ssl_select_cert_success;
 }
 
+absl::optional<Ssl::ProvidedCertificateConstSharedPtr>
+ServerContextImpl::providedCertificate(const SSL_CLIENT_HELLO* ssl_client_hello) {
+  auto* selection = static_cast<AsyncCertificateSelection*>(
+      SSL_get_ex_data(ssl_client_hello->ssl, sslCertificateSelectionIndex()));
+  if (selection == nullptr) {
+    // The connection can't be resumed, e.g. it was not created by the TLS transport socket.
+    return nullptr;
+  }
+  if (selection->pending()) {
+    return absl::nullopt;
+  }
+  if (selection->complete()) {
+    return selection->certificate();
+  }
+
+  const uint8_t* data;
+  size_t size;
+  if (!SSL_early_callback_ctx_extension_get(ssl_client_hello, TLSEXT_TYPE_server_name, &data,
+                                            &size)) {
+    return nullptr;
+  }
+  // The server_name extension holds a list of names of which only host_name is defined.
+  CBS extension, server_name_list, host_name;
+  uint8_t name_type;
+  CBS_init(&extension, data, size);
+  if (!CBS_get_u16_length_prefixed(&extension, &server_name_list) ||
+      !CBS_get_u8(&server_name_list, &name_type) || name_type != TLSEXT_NAMETYPE_host_name ||
+      !CBS_get_u16_length_prefixed(&server_name_list, &host_name) || CBS_len(&host_name) == 0) {
+    return nullptr;
+  }
+  const std::string server_name = absl::AsciiStrToLower(absl::string_view(
+      reinterpret_cast<const char*>(CBS_data(&host_name)), CBS_len(&host_name)));
+
+  Ssl::ProvidedCertificateConstSharedPtr certificate;
+  switch (provided_certificate_cache_.lookup(server_name, *selection, certificate)) {
+  case ProvidedCertificateCache::LookupStatus::Hit:
+    stats_.provided_certificate_cache_hit_.inc();
+    return certificate;
+  case ProvidedCertificateCache::LookupStatus::Waiting:
+    stats_.provided_certificate_cache_miss_.inc();
+    selection->wait(provided_certificate_cache_, server_name);
+    return absl::nullopt;
+  case ProvidedCertificateCache::LookupStatus::Miss:
+    stats_.provided_certificate_cache_miss_.inc();
+    selection->fetch(*certificate_provider_, provided_certificate_cache_, server_name);
+    return absl::nullopt;
+  }
+  PANIC_DUE_TO_CORRUPT_ENUM;
+}
+
+AsyncCertificateSelection::~AsyncCertificateSelection() {
+  if (pending_fetch_ != nullptr) {
+    pending_fetch_->cancel();
+    // Let the connections waiting for this fetch look the server name up again.
+    cache_->fetchDone(server_name_, absl::nullopt);
+  } else if (waiting_) {
+    cache_->removeWaiter(server_name_, *this);
+  }
+}
+
+void AsyncCertificateSelection::fetch(Ssl::CertificateProvider& provider,
+                                      ProvidedCertificateCache& cache,
+                                      absl::string_view server_name) {
+  ASSERT(!pending() && !complete());
+  cache_ = &cache;
+  server_name_ = std::string(server_name);
+  pending_fetch_ = provider.fetchCertificate(server_name_, dispatcher_, *this);
+  ASSERT(pending_fetch_ != nullptr);
+}
+
+void AsyncCertificateSelection::wait(ProvidedCertificateCache& cache,
+                                     absl::string_view server_name) {
+  ASSERT(!pending() && !complete());
+  cache_ = &cache;
+  server_name_ = std::string(server_name);
+  waiting_ = true;
+}
+
+void AsyncCertificateSelection::onCertificateFetchComplete(
+    Ssl::ProvidedCertificateConstSharedPtr certificate) {
+  ASSERT(dispatcher_.isThreadSafe());
+  ASSERT(pending_fetch_ != nullptr);
+  pending_fetch_ = nullptr;
+  certificate_ = std::move(certificate);
+  complete_ = true;
+  cache_->fetchDone(server_name_, certificate_);
+  callbacks_.onCertificateSelectionComplete();
+}
+
+void AsyncCertificateSelection::onFetchDone(
+    absl::optional<Ssl::ProvidedCertificateConstSharedPtr> certificate) {
+  // This runs on the thread of the connection that fetched the certificate.
+  dispatcher_.post([this, alive = std::weak_ptr<bool>(alive_),
+                    certificate = std::move(certificate)]() {
+    if (alive.expired()) {
+      return;
+    }
+    ASSERT(waiting_);
+    waiting_ = false;
+    if (certificate.has_value()) {
+      certificate_ = certificate.value();
+      complete_ = true;
+    }
+    // Without a certificate the fetch was cancelled, and resuming the handshake looks the server
+    // name up again.
+    callbacks_.onCertificateSelectionComplete();
+  });
+}
+
 bool TlsContext::isCipherEnabled(uint16_t cipher_id, uint16_t client_version) {
   const SSL_CIPHER* c = SSL_get_cipher_by_value(cipher_id);
   if (c == nullptr) {
@@ -7,6 +7,7 @@
 #include <vector>
 
 #include "envoy/network/transport_socket.h"
+#include "envoy/ssl/certificate_provider.h"
 #include "envoy/ssl/context.h"
 #include "envoy/ssl/context_config.h"
 #include "envoy/ssl/private_key/private_key.h"
@@ -19,9 +20,11 @@
 #include "source/extensions/transport_sockets/tls/cert_validator/cert_validator.h"
 #include "source/extensions/transport_sockets/tls/context_manager_impl.h"
 #include "source/extensions/transport_sockets/tls/ocsp/ocsp.h"
+#include "source/extensions/transport_sockets/tls/provided_certificate_cache.h"
 #include "source/extensions/transport_sockets/tls/stats.h"
 
 #include "absl/synchronization/mutex.h"
+#include "absl/types/optional.h"
 #include "openssl/ssl.h"
 #include "openssl/x509v3.h"
 
@@ -78,6 +81,19 @@ public:
    */
   static int sslExtendedSocketInfoIndex();
 
+  /**
+   * The global SSL-library index used for storing a pointer to the AsyncCertificateSelection
+   * of a server connection in the SSL instance, for retrieval in callbacks.
+   */
+  static int sslCertificateSelectionIndex();
+
+  /**
+   * @return the provider of certificates selected at handshake time, or nullptr.
+   */
+  const Ssl::CertificateProviderSharedPtr& certificateProvider() const {
+    return certificate_provider_;
+  }
+
   // Ssl::Context
   size_t daysUntilFirstCertExpires() const override;
   Envoy::Ssl::CertificateDetailsPtr getCaCertInformation() const override;
@@ -130,6 +146,7 @@ protected:
   const Stats::StatName ssl_curves_;
   const Stats::StatName ssl_sigalgs_;
   const Ssl::HandshakerCapabilities capabilities_;
+  Ssl::CertificateProviderSharedPtr certificate_provider_;
 };
 
 using ContextImplSharedPtr = std::shared_ptr<ContextImpl>;
@@ -155,6 +172,47 @@ private:
 
 enum class OcspStapleAction { Staple, NoStaple, Fail, ClientNotCapable };
 
+/**
+ * Per-connection state of a certificate fetched from an Ssl::CertificateProvider. It is stored in
+ * the SSL instance so that the select certificate callback finds the result of the fetch when
+ * the suspended handshake is resumed. The connection either fetches the certificate itself, or
+ * waits for the fetch started by another connection for the same server name.
+ */
+class AsyncCertificateSelection : public Ssl::CertificateProviderCallbacks,
+                                  public ProvidedCertificateCache::Waiter {
+public:
+  AsyncCertificateSelection(Ssl::CertificateSelectionCallbacks& callbacks,
+                            Event::Dispatcher& dispatcher)
+      : callbacks_(callbacks), dispatcher_(dispatcher) {}
+  ~AsyncCertificateSelection() override;
+
+  void fetch(Ssl::CertificateProvider& provider, ProvidedCertificateCache& cache,
+             absl::string_view server_name);
+  void wait(ProvidedCertificateCache& cache, absl::string_view server_name);
+  bool pending() const { return pending_fetch_ != nullptr || waiting_; }
+  bool complete() const { return complete_; }
+  const Ssl::ProvidedCertificateConstSharedPtr& certificate() const { return certificate_; }
+
+  // Ssl::CertificateProviderCallbacks
+  void onCertificateFetchComplete(Ssl::ProvidedCertificateConstSharedPtr certificate) override;
+
+  // ProvidedCertificateCache::Waiter
+  void onFetchDone(absl::optional<Ssl::ProvidedCertificateConstSharedPtr> certificate) override;
+
+private:
+  Ssl::CertificateSelectionCallbacks& callbacks_;
+  Event::Dispatcher& dispatcher_;
+  // Lets the results posted by the connections fetching a certificate that this connection waits
+  // for tell whether it is still alive.
+  const std::shared_ptr<bool> alive_{std::make_shared<bool>(true)};
+  ProvidedCertificateCache* cache_{};
+  Ssl::CertificateFetch* pending_fetch_{};
+  bool waiting_{};
+  std::string server_name_;
+  Ssl::ProvidedCertificateConstSharedPtr certificate_;
+  bool complete_{};
+};
+
 class ServerContextImpl : public ContextImpl, public Envoy::Ssl::ServerContext {
 public:
   ServerContextImpl(Stats::Scope& scope, const Envoy::Ssl::ServerContextConfig& config,
@@ -175,11 +233,16 @@ private:
   bool isClientEcdsaCapable(const SSL_CLIENT_HELLO* ssl_client_hello);
   bool isClientOcspCapable(const SSL_CLIENT_HELLO* ssl_client_hello);
   OcspStapleAction ocspStapleAction(const TlsContext& ctx, bool client_ocsp_capable);
+  // Returns the certificate supplied by the certificate provider for the SNI, nullptr if the
+  // configured certificates are to be used, or absl::nullopt while it is being fetched.
+  absl::optional<Ssl::ProvidedCertificateConstSharedPtr>
+  providedCertificate(const SSL_CLIENT_HELLO* ssl_client_hello);
 
   SessionContextID generateHashForSessionContextId(const std::vector<std::string>& server_names);
 
   const std::vector<Envoy::Ssl::ServerContextConfig::SessionTicketKey> session_ticket_keys_;
   const Ssl::ServerContextConfig::OcspStaplePolicy ocsp_staple_policy_;
+  ProvidedCertificateCache provided_certificate_cache_;
 };
 
 } // namespace Tls
@@ -0,0 +1,100 @@
+#include "source/extensions/transport_sockets/tls/provided_certificate_cache.h"
+
+#include <algorithm>
+
+#include "source/common/common/assert.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace TransportSockets {
+namespace Tls {
+
+ProvidedCertificateCache::LookupStatus
+ProvidedCertificateCache::lookup(absl::string_view server_name, Waiter& waiter,
+                                 Ssl::ProvidedCertificateConstSharedPtr& certificate) {
+  absl::MutexLock lock(&mutex_);
+  auto it = index_.find(server_name);
+  if (it != index_.end()) {
+    const Entry& entry = *it->second;
+    if (!entry.expiry_time_.has_value() ||
+        time_source_.monotonicTime() < entry.expiry_time_.value()) {
+      // Move the entry to the front without invalidating the iterators in the index.
+      entries_.splice(entries_.begin(), entries_, it->second);
+      certificate = entry.certificate_;
+      return LookupStatus::Hit;
+    }
+    const EntryList::iterator expired = it->second;
+    index_.erase(it);
+    entries_.erase(expired);
+  }
+
+  auto fetch_it = fetches_.find(server_name);
+  if (fetch_it != fetches_.end()) {
+    fetch_it->second.push_back(&waiter);
+    return LookupStatus::Waiting;
+  }
+  fetches_.emplace(std::string(server_name), std::vector<Waiter*>());
+  return LookupStatus::Miss;
+}
+
+void ProvidedCertificateCache::fetchDone(
+    absl::string_view server_name,
+    absl::optional<Ssl::ProvidedCertificateConstSharedPtr> certificate) {
+  absl::MutexLock lock(&mutex_);
+  if (certificate.has_value()) {
+    insert(server_name, certificate.value());
+  }
+
+  auto fetch_it = fetches_.find(server_name);
+  ASSERT(fetch_it != fetches_.end());
+  for (Waiter* waiter : fetch_it->second) {
+    waiter->onFetchDone(certificate);
+  }
+  fetches_.erase(fetch_it);
+}
+
+void ProvidedCertificateCache::removeWaiter(absl::string_view server_name, Waiter& waiter) {
+  absl::MutexLock lock(&mutex_);
+  auto fetch_it = fetches_.find(server_name);
+  if (fetch_it != fetches_.end()) {
+    auto& waiters = fetch_it->second;
+    waiters.erase(std::remove(waiters.begin(), waiters.end(), &waiter), waiters.end());
+  }
+}
+
+void ProvidedCertificateCache::insert(absl::string_view server_name,
+                                      Ssl::ProvidedCertificateConstSharedPtr certificate) {
+  if (max_entries_ == 0 || (certificate == nullptr && negative_ttl_.count() == 0)) {
+    return;
+  }
+
+  absl::optional<MonotonicTime> expiry_time;
+  if (certificate == nullptr) {
+    expiry_time = time_source_.monotonicTime() + negative_ttl_;
+  }
+
+  auto it = index_.find(server_name);
+  if (it != index_.end()) {
+    it->second->certificate_ = std::move(certificate);
+    it->second->expiry_time_ = expiry_time;
+    entries_.splice(entries_.begin(), entries_, it->second);
+    return;
+  }
+
+  if (entries_.size() >= max_entries_) {
+    index_.erase(entries_.back().server_name_);
+    entries_.pop_back();
+  }
+  entries_.push_front({std::string(server_name), std::move(certificate), expiry_time});
+  index_.emplace(entries_.front().server_name_, entries_.begin());
+}
+
+size_t ProvidedCertificateCache::size() const {
+  absl::MutexLock lock(&mutex_);
+  return entries_.size();
+}
+
+} // namespace Tls
+} // namespace TransportSockets
+} // namespace Extensions
+} // namespace Envoy
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <chrono>
+#include <list>
+#include <string>
+#include <vector>
+
+#include "envoy/common/pure.h"
+#include "envoy/common/time.h"
+#include "envoy/ssl/certificate_provider.h"
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/strings/string_view.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/types/optional.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace TransportSockets {
+namespace Tls {
+
+/**
+ * A bounded LRU cache of the certificates returned by an Ssl::CertificateProvider, keyed by
+ * server name. It is shared by all of the workers handshaking with the same server context.
+ * Server names the provider has no certificate for are cached for a limited time. Concurrent
+ * handshakes for a server name that is not cached share a single fetch.
+ */
+class ProvidedCertificateCache {
+public:
+  /**
+   * A handshake waiting for the certificate fetched by another handshake.
+   */
+  class Waiter {
+  public:
+    virtual ~Waiter() = default;
+
+    /**
+     * Called when the fetch being waited for is done. This is called with the cache lock held,
+     * from the thread of the handshake that fetched the certificate, so the waiter must only hand
+     * the result over to its own thread.
+     * @param certificate supplies the fetched certificate, nullptr if the provider has none, or
+     *        absl::nullopt if the fetch was cancelled and the server name has to be looked up
+     *        again.
+     */
+    virtual void onFetchDone(absl::optional<Ssl::ProvidedCertificateConstSharedPtr> certificate)
+        PURE;
+  };
+
+  enum class LookupStatus {
+    // The result of an earlier fetch is cached.
+    Hit,
+    // Another handshake is fetching the certificate. The waiter is called once it is done.
+    Waiting,
+    // The caller is to fetch the certificate and call fetchDone() once it is done.
+    Miss,
+  };
+
+  /**
+   * @param max_entries supplies the maximum number of cached certificates. Once reached, the
+   *        least recently used certificate is evicted. Nothing is cached if zero.
+   * @param negative_ttl supplies how long a server name without a certificate is cached.
+   * @param time_source supplies the time source used to expire those entries.
+   */
+  ProvidedCertificateCache(uint32_t max_entries, std::chrono::milliseconds negative_ttl,
+                           TimeSource& time_source)
+      : max_entries_(max_entries), negative_ttl_(negative_ttl), time_source_(time_source) {}
+
+  /**
+   * Look up the certificate for the server name.
+   * @param server_name supplies the server name.
+   * @param waiter supplies the waiter to add if the certificate is being fetched.
+   * @param certificate is set to the cached certificate on a hit, or to nullptr if the provider
+   *        has no certificate for the server name.
+   * @return LookupStatus whether the certificate was cached, is being fetched or is to be fetched.
+   */
+  LookupStatus lookup(absl::string_view server_name, Waiter& waiter,
+                      Ssl::ProvidedCertificateConstSharedPtr& certificate);
+
+  /**
+   * Complete the fetch started after a Miss, caching the result and handing it to the waiters.
+   * @param server_name supplies the server name that was looked up.
+   * @param certificate supplies the fetched certificate, nullptr if the provider has none, or
+   *        absl::nullopt if the fetch was cancelled.
+   */
+  void fetchDone(absl::string_view server_name,
+                 absl::optional<Ssl::ProvidedCertificateConstSharedPtr> certificate);
+
+  /**
+   * Remove a waiter that is going away before the fetch it waits for is done.
+   */
+  void removeWaiter(absl::string_view server_name, Waiter& waiter);
+
+  size_t size() const;
+
+private:
+  struct Entry {
+    std::string server_name_;
+    // nullptr if the provider has no certificate for the server name.
+    Ssl::ProvidedCertificateConstSharedPtr certificate_;
+    // Only set for entries without a certificate.
+    absl::optional<MonotonicTime> expiry_time_;
+  };
+  using EntryList = std::list<Entry>;
+
+  void insert(absl::string_view server_name, Ssl::ProvidedCertificateConstSharedPtr certificate)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(mutex_);
+
+  const uint32_t max_entries_;
+  const std::chrono::milliseconds negative_ttl_;
+  TimeSource& time_source_;
+  mutable absl::Mutex mutex_;
+  // Most recently used first. The index keys point into the list entries, which are stable.
+  EntryList entries_ ABSL_GUARDED_BY(mutex_);
+  absl::flat_hash_map<absl::string_view, EntryList::iterator> index_ ABSL_GUARDED_BY(mutex_);
+  // The handshakes waiting for each server name that is being fetched.
+  absl::flat_hash_map<std::string, std::vector<Waiter*>> fetches_ ABSL_GUARDED_BY(mutex_);
+};
+
+} // namespace Tls
+} // namespace TransportSockets
+} // namespace Extensions
+} // namespace Envoy
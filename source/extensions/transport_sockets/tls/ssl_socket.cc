@@ -72,6 +72,14 @@ void SslSocket::setTransportSocketCallbacks(Network::TransportSocketCallbacks& c
     provider->registerPrivateKeyMethod(rawSsl(), *this, callbacks_->connection().dispatcher());
   }
 
+  // Allow the handshake to be suspended while the certificate for the SNI is fetched.
+  if (ctx_->certificateProvider() != nullptr) {
+    certificate_selection_ = std::make_unique<AsyncCertificateSelection>(
+        *this, callbacks_->connection().dispatcher());
+    SSL_set_ex_data(rawSsl(), ContextImpl::sslCertificateSelectionIndex(),
+                    certificate_selection_.get());
+  }
+
   // Use custom BIO that reads from/writes to IoHandle
   BIO* bio = BIO_new_io_handle(&callbacks_->ioHandle());
   SSL_set_bio(rawSsl(), bio, bio);
@@ -164,7 +172,11 @@ Network::IoResult SslSocket::doRead(Buffer::Instance& read_buffer) {
   return {action, bytes_read, end_stream};
 }
 
-void SslSocket::onPrivateKeyMethodComplete() {
+void SslSocket::onPrivateKeyMethodComplete() { resumeHandshake(); }
+
+void SslSocket::onCertificateSelectionComplete() { resumeHandshake(); }
+
+void SslSocket::resumeHandshake() {
   ASSERT(callbacks_ != nullptr && callbacks_->connection().dispatcher().isThreadSafe());
   ASSERT(info_->state() == Ssl::SocketState::HandshakeInProgress);
 
@@ -6,6 +6,7 @@
 #include "envoy/network/connection.h"
 #include "envoy/network/transport_socket.h"
 #include "envoy/secret/secret_callbacks.h"
+#include "envoy/ssl/certificate_provider.h"
 #include "envoy/ssl/handshaker.h"
 #include "envoy/ssl/private_key/private_key_callbacks.h"
 #include "envoy/ssl/ssl_socket_extended_info.h"
@@ -44,6 +45,7 @@ enum class InitialState { Client, Server };
 
 class SslSocket : public Network::TransportSocket,
                   public Envoy::Ssl::PrivateKeyConnectionCallbacks,
+                  public Envoy::Ssl::CertificateSelectionCallbacks,
                   public Ssl::HandshakeCallbacks,
                   protected Logger::Loggable<Logger::Id::connection> {
 public:
@@ -64,6 +66,8 @@ public:
   bool startSecureTransport() override { return false; }
   // Ssl::PrivateKeyConnectionCallbacks
   void onPrivateKeyMethodComplete() override;
+  // Ssl::CertificateSelectionCallbacks
+  void onCertificateSelectionComplete() override;
   // Ssl::HandshakeCallbacks
   Network::Connection& connection() const override;
   void onSuccess(SSL* ssl) override;
@@ -83,6 +87,7 @@ private:
   ReadResult sslReadIntoSlice(Buffer::RawSlice& slice);
 
   Network::PostIoAction doHandshake();
+  void resumeHandshake();
   void drainErrorQueue();
   void shutdownSsl();
   void shutdownBasic();
@@ -94,6 +99,7 @@ private:
   std::string failure_reason_;
 
   SslHandshakerImplSharedPtr info_;
+  std::unique_ptr<AsyncCertificateSelection> certificate_selection_;
 };
 
 class ClientSslSocketFactory : public Network::TransportSocketFactory,
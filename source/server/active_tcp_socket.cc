@@ -114,8 +114,18 @@ void ActiveTcpSocket::setDynamicMetadata(const std::string& name,
   stream_info_->setDynamicMetadata(name, value);
 }
 
+Network::ListenerFilterBuffer& ActiveTcpSocket::listenerFilterBuffer() {
+  if (listener_filter_buffer_ == nullptr) {
+    listener_filter_buffer_ =
+        std::make_unique<Network::ListenerFilterBufferImpl>(socket_->ioHandle());
+  }
+  return *listener_filter_buffer_;
+}
+
 void ActiveTcpSocket::newConnection() {
   connected_ = true;
+  // The listener filters are done peeking at the socket.
+  listener_filter_buffer_.reset();
 
   // Check if the socket may need to be redirected to another listener.
   Network::BalancedConnectionHandlerOptRef new_listener;
@@ -13,6 +13,7 @@
 #include "envoy/network/listener.h"
 
 #include "source/common/common/linked_object.h"
+#include "source/common/network/listener_filter_buffer_impl.h"
 #include "source/server/active_listener_base.h"
 
 namespace Envoy {
@@ -86,6 +87,7 @@ struct ActiveTcpSocket : public Network::ListenerFilterManager,
   };
 
   StreamInfo::FilterState& filterState() override { return *stream_info_->filterState().get(); }
+  Network::ListenerFilterBuffer& listenerFilterBuffer() override;
 
   // The owner of this ActiveTcpSocket.
   ActiveStreamListenerBase& listener_;
@@ -95,6 +97,8 @@ struct ActiveTcpSocket : public Network::ListenerFilterManager,
   std::list<ListenerFilterWrapperPtr>::iterator iter_;
   Event::TimerPtr timer_;
   std::unique_ptr<StreamInfo::StreamInfo> stream_info_;
+  // The data peeked from socket_ by the listener filters, created when the first one peeks.
+  std::unique_ptr<Network::ListenerFilterBufferImpl> listener_filter_buffer_;
   bool connected_{false};
 };
 
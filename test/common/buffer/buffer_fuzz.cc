@@ -97,6 +97,15 @@ public:
     add(src.start(), src.size_);
   }
 
+  size_t addFragments(absl::Span<const absl::string_view> fragments) override {
+    size_t total_size = 0;
+    for (const absl::string_view& fragment : fragments) {
+      add(fragment);
+      total_size += fragment.size();
+    }
+    return total_size;
+  }
+
   void prepend(absl::string_view data) override {
     FUZZ_ASSERT(start_ >= data.size());
     start_ -= data.size();
@@ -178,6 +178,40 @@ static void bufferAddBuffer(benchmark::State& state) {
 }
 BENCHMARK(bufferAddBuffer)->Arg(1)->Arg(4096)->Arg(16384)->Arg(65536);
 
+// Serialize a set of HTTP/1 style header lines into a WatermarkBuffer, either one piece at a time
+// with add() or one line at a time with addFragments(), as the HTTP/1 codec does.
+static void bufferAddHeaderLines(benchmark::State& state) {
+  const bool use_add_fragments = (state.range(0) != 0);
+  const std::vector<std::pair<std::string, std::string>> headers = {
+      {"content-type", "application/json"},
+      {"content-length", "1234"},
+      {"date", "Mon, 18 Oct 2021 10:00:00 GMT"},
+      {"server", "envoy"},
+      {"x-envoy-upstream-service-time", "3"},
+      {"cache-control", "private, max-age=300, no-transform"},
+  };
+  Buffer::WatermarkBuffer buffer([]() {}, []() {}, []() {});
+  buffer.setWatermarks(MaxBufferLength);
+  for (auto _ : state) {
+    UNREFERENCED_PARAMETER(_);
+    for (const auto& header : headers) {
+      if (use_add_fragments) {
+        buffer.addFragments({header.first, ": ", header.second, "\r\n"});
+      } else {
+        buffer.add(header.first);
+        buffer.add(": ");
+        buffer.add(header.second);
+        buffer.add("\r\n");
+      }
+    }
+    if (buffer.length() >= MaxBufferLength) {
+      buffer.drain(buffer.length());
+    }
+  }
+  benchmark::DoNotOptimize(buffer.length());
+}
+BENCHMARK(bufferAddHeaderLines)->Arg(0)->Arg(1);
+
 // Test the prepending of varying amounts of content from a string to an OwnedImpl.
 static void bufferPrependString(benchmark::State& state) {
   const std::string data(state.range(0), 'a');
@@ -204,6 +204,25 @@ TEST_F(OwnedImplTest, Add) {
   EXPECT_EQ(string1 + string2 + big_suffix, buffer.toString());
 }
 
+TEST_F(OwnedImplTest, AddFragments) {
+  Buffer::OwnedImpl buffer;
+  EXPECT_EQ(0, buffer.addFragments({}));
+  EXPECT_EQ(0, buffer.addFragments({"", ""}));
+  EXPECT_EQ(0, buffer.length());
+
+  EXPECT_EQ(13, buffer.addFragments({"Hello", ", ", "World!"}));
+  EXPECT_EQ(13, buffer.length());
+  EXPECT_EQ("Hello, World!", buffer.toString());
+  EXPECT_EQ(1, buffer.getRawSlices().size());
+
+  // Fragments that do not fit in the space remaining at the end of the buffer spill over into
+  // new slices.
+  const std::string big_fragment(16384, 'a');
+  EXPECT_EQ(1 + big_fragment.size(), buffer.addFragments({"-", big_fragment}));
+  EXPECT_EQ(14 + big_fragment.size(), buffer.length());
+  EXPECT_EQ("Hello, World!-" + big_fragment, buffer.toString());
+}
+
 TEST_F(OwnedImplTest, Prepend) {
   const std::string suffix = "World!", prefix = "Hello, ";
   Buffer::OwnedImpl buffer;
@@ -69,6 +69,14 @@ TEST_F(WatermarkBufferTest, AddBuffer) {
   EXPECT_EQ(11, buffer_.length());
 }
 
+TEST_F(WatermarkBufferTest, AddFragments) {
+  EXPECT_EQ(10, buffer_.addFragments({"01234", "56789"}));
+  EXPECT_EQ(0, times_high_watermark_called_);
+  EXPECT_EQ(1, buffer_.addFragments({"a"}));
+  EXPECT_EQ(1, times_high_watermark_called_);
+  EXPECT_EQ(11, buffer_.length());
+}
+
 TEST_F(WatermarkBufferTest, Prepend) {
   std::string suffix = "World!", prefix = "Hello, ";
 
@@ -0,0 +1,127 @@
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "source/common/common/atomic_token_bucket_impl.h"
+
+#include "test/test_common/simulated_time_system.h"
+
+#include "gtest/gtest.h"
+
+namespace Envoy {
+
+class AtomicTokenBucketImplTest : public testing::Test {
+protected:
+  Event::SimulatedTimeSystem time_system_;
+  std::chrono::milliseconds time_to_next_token;
+};
+
+// Verifies TokenBucket initialization.
+TEST_F(AtomicTokenBucketImplTest, Initialization) {
+  AtomicTokenBucketImpl token_bucket{1, time_system_, -1.0};
+
+  EXPECT_EQ(1, token_bucket.consume(1, false, time_to_next_token));
+  EXPECT_EQ(0, token_bucket.consume(1, false, time_to_next_token));
+}
+
+// Verifies TokenBucket's maximum capacity.
+TEST_F(AtomicTokenBucketImplTest, MaxBucketSize) {
+  AtomicTokenBucketImpl token_bucket{3, time_system_, 1};
+
+  EXPECT_EQ(3, token_bucket.consume(3, false, time_to_next_token));
+  time_system_.setMonotonicTime(std::chrono::seconds(10));
+  EXPECT_EQ(0, token_bucket.consume(4, false, time_to_next_token));
+  EXPECT_EQ(3, token_bucket.consume(3, false, time_to_next_token));
+}
+
+// Verifies that TokenBucket can consume tokens.
+TEST_F(AtomicTokenBucketImplTest, Consume) {
+  AtomicTokenBucketImpl token_bucket{10, time_system_, 1};
+
+  EXPECT_EQ(0, token_bucket.consume(20, false, time_to_next_token));
+  EXPECT_EQ(9, token_bucket.consume(9, false, time_to_next_token));
+
+  EXPECT_EQ(1, token_bucket.consume(1, false, time_to_next_token));
+
+  time_system_.setMonotonicTime(std::chrono::milliseconds(999));
+  EXPECT_EQ(0, token_bucket.consume(1, false, time_to_next_token));
+
+  time_system_.setMonotonicTime(std::chrono::milliseconds(5999));
+  EXPECT_EQ(0, token_bucket.consume(6, false, time_to_next_token));
+
+  time_system_.setMonotonicTime(std::chrono::milliseconds(6000));
+  EXPECT_EQ(6, token_bucket.consume(6, false, time_to_next_token));
+  EXPECT_EQ(0, token_bucket.consume(1, false, time_to_next_token));
+}
+
+// Verifies that TokenBucket can refill tokens.
+TEST_F(AtomicTokenBucketImplTest, Refill) {
+  AtomicTokenBucketImpl token_bucket{1, time_system_, 0.5};
+  EXPECT_EQ(1, token_bucket.consume(1, false, time_to_next_token));
+
+  time_system_.setMonotonicTime(std::chrono::milliseconds(500));
+  EXPECT_EQ(0, token_bucket.consume(1, false, time_to_next_token));
+  time_system_.setMonotonicTime(std::chrono::milliseconds(1500));
+  EXPECT_EQ(0, token_bucket.consume(1, false, time_to_next_token));
+  time_system_.setMonotonicTime(std::chrono::milliseconds(2000));
+  EXPECT_EQ(1, token_bucket.consume(1, false, time_to_next_token));
+}
+
+TEST_F(AtomicTokenBucketImplTest, NextTokenAvailable) {
+  AtomicTokenBucketImpl token_bucket{10, time_system_, 5};
+  EXPECT_EQ(9, token_bucket.consume(9, false, time_to_next_token));
+  EXPECT_EQ(std::chrono::milliseconds(0), token_bucket.nextTokenAvailable());
+  EXPECT_EQ(1, token_bucket.consume(1, false, time_to_next_token));
+  EXPECT_EQ(0, token_bucket.consume(1, false, time_to_next_token));
+  EXPECT_EQ(std::chrono::milliseconds(200), token_bucket.nextTokenAvailable());
+}
+
+// Test partial consumption of tokens.
+TEST_F(AtomicTokenBucketImplTest, PartialConsumption) {
+  AtomicTokenBucketImpl token_bucket{16, time_system_, 16};
+  EXPECT_EQ(16, token_bucket.consume(18, true, time_to_next_token));
+  EXPECT_EQ(std::chrono::milliseconds(63), token_bucket.nextTokenAvailable());
+  time_system_.advanceTimeWait(std::chrono::milliseconds(62));
+  EXPECT_EQ(0, token_bucket.consume(1, true, time_to_next_token));
+  time_system_.advanceTimeWait(std::chrono::milliseconds(1));
+  EXPECT_EQ(1, token_bucket.consume(2, true, time_to_next_token));
+  EXPECT_EQ(std::chrono::milliseconds(63), token_bucket.nextTokenAvailable());
+}
+
+// Test reset functionality for a shared token bucket.
+TEST_F(AtomicTokenBucketImplTest, Reset) {
+  AtomicTokenBucketImpl token_bucket{16, time_system_, 16};
+  token_bucket.maybeReset(1);
+
+  EXPECT_EQ(1, token_bucket.consume(2, true, time_to_next_token));
+  EXPECT_EQ(std::chrono::milliseconds(63), token_bucket.nextTokenAvailable());
+
+  // Reset again. Should be ignored for shared bucket.
+  token_bucket.maybeReset(5);
+  EXPECT_EQ(0, token_bucket.consume(5, true, time_to_next_token));
+}
+
+// Verifies that concurrent consumers never take more tokens than the bucket holds.
+TEST_F(AtomicTokenBucketImplTest, ConcurrentConsume) {
+  const uint64_t max_tokens = 10000;
+  AtomicTokenBucketImpl token_bucket{max_tokens, time_system_, 1};
+
+  std::atomic<uint64_t> total_consumed{0};
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 8; ++i) {
+    threads.emplace_back([&] {
+      uint64_t consumed;
+      while ((consumed = token_bucket.consume(3, true)) > 0) {
+        total_consumed += consumed;
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(max_tokens, total_consumed);
+  EXPECT_EQ(std::chrono::milliseconds(1000), token_bucket.nextTokenAvailable());
+}
+
+} // namespace Envoy
@@ -0,0 +1,43 @@
+// Note: this should be run with --compilation_mode=opt, and would benefit from a
+// quiescent system with disabled cstate power management.
+
+#include <memory>
+
+#include "source/common/common/atomic_token_bucket_impl.h"
+#include "source/common/common/shared_token_bucket_impl.h"
+#include "source/common/event/real_time_system.h"
+
+#include "benchmark/benchmark.h"
+
+namespace Envoy {
+
+// A bucket large enough, and refilled quickly enough, that it is never exhausted while the
+// benchmark runs. This measures the cost of sharing the bucket rather than of waiting for tokens.
+constexpr uint64_t MaxTokens = uint64_t{1} << 40;
+
+static Event::RealTimeSystem time_system;
+static std::unique_ptr<TokenBucket> token_bucket;
+
+template <class BucketType> static void BM_SharedBucketConsume(benchmark::State& state) {
+  if (state.thread_index == 0) {
+    token_bucket = std::make_unique<BucketType>(MaxTokens, time_system, MaxTokens);
+  }
+
+  // The bucket is only guaranteed to be set up once all threads enter the benchmark loop.
+  for (auto _ : state) {
+    UNREFERENCED_PARAMETER(_);
+    benchmark::DoNotOptimize(token_bucket->consume(1024, true));
+  }
+
+  if (state.thread_index == 0) {
+    token_bucket.reset();
+  }
+}
+BENCHMARK_TEMPLATE(BM_SharedBucketConsume, SharedTokenBucketImpl)
+    ->ThreadRange(1, 64)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_SharedBucketConsume, AtomicTokenBucketImpl)
+    ->ThreadRange(1, 64)
+    ->UseRealTime();
+
+} // namespace Envoy
@@ -263,6 +263,26 @@ TEST_F(ConnPoolImplBaseTest, PreconnectOnDisconnect) {
   pool_.destructAllConnections();
 }
 
+// Closing an idle connection locally, e.g. when draining, does not establish a replacement.
+TEST_F(ConnPoolImplBaseTest, NoPreconnectOnIdleLocalClose) {
+  // Create more than one connection per new stream.
+  ON_CALL(*cluster_, perUpstreamPreconnectRatio).WillByDefault(Return(1.5));
+
+  EXPECT_CALL(pool_, instantiateActiveClient).Times(2);
+  pool_.newStreamImpl(context_);
+
+  EXPECT_CALL(pool_, onPoolReady);
+  clients_[0]->onEvent(Network::ConnectionEvent::Connected);
+  clients_[1]->onEvent(Network::ConnectionEvent::Connected);
+  EXPECT_EQ(ActiveClient::State::READY, clients_[1]->state());
+
+  EXPECT_CALL(pool_, instantiateActiveClient).Times(0);
+  clients_[1]->close();
+  CHECK_STATE(1 /*active*/, 0 /*pending*/, 0 /*connecting capacity*/);
+
+  pool_.destructAllConnections();
+}
+
 TEST_F(ConnPoolImplBaseTest, NoPreconnectIfUnhealthy) {
   // Create more than one connection per new stream.
   ON_CALL(*cluster_, perUpstreamPreconnectRatio).WillByDefault(Return(1.5));
@@ -325,6 +345,58 @@ TEST_F(ConnPoolImplBaseTest, ExplicitPreconnectNotHealthy) {
   EXPECT_FALSE(pool_.maybePreconnectImpl(1));
 }
 
+// If the upstream closes an idle preconnected connection while streams are active, it is replaced.
+TEST_F(ConnPoolImplDispatcherBaseTest, PreconnectOnIdleRemoteClose) {
+  ON_CALL(*cluster_, maxConnectionDuration).WillByDefault(Return(absl::nullopt));
+  // Create more than one connection per new stream.
+  ON_CALL(*cluster_, perUpstreamPreconnectRatio).WillByDefault(Return(1.5));
+
+  // On new stream, create 2 connections.
+  EXPECT_CALL(pool_, instantiateActiveClient).Times(2);
+  pool_.newStreamImpl(context_);
+  CHECK_STATE(0 /*active*/, 1 /*pending*/, 2 /*connecting capacity*/);
+
+  // The first connection serves the stream and the second one stays idle.
+  EXPECT_CALL(pool_, onPoolReady);
+  clients_[0]->onEvent(Network::ConnectionEvent::Connected);
+  clients_[1]->onEvent(Network::ConnectionEvent::Connected);
+  EXPECT_EQ(ActiveClient::State::READY, clients_[1]->state());
+  CHECK_STATE(1 /*active*/, 0 /*pending*/, 1 /*connecting capacity*/);
+
+  // The upstream closes the idle connection after a while, so a replacement is established.
+  time_system_.advanceTimeAndRun(std::chrono::seconds(1), *dispatcher_,
+                                 Event::Dispatcher::RunType::NonBlock);
+  EXPECT_CALL(pool_, instantiateActiveClient);
+  clients_[1]->onEvent(Network::ConnectionEvent::RemoteClose);
+  CHECK_STATE(1 /*active*/, 0 /*pending*/, 1 /*connecting capacity*/);
+
+  pool_.destructAllConnections();
+}
+
+// If the upstream closes an idle connection right after it is established, it is not replaced
+// until a stream needs it, so upstreams that close idle connections don't cause a reconnect loop.
+TEST_F(ConnPoolImplDispatcherBaseTest, NoPreconnectOnImmediateIdleRemoteClose) {
+  ON_CALL(*cluster_, maxConnectionDuration).WillByDefault(Return(absl::nullopt));
+  // Create more than one connection per new stream.
+  ON_CALL(*cluster_, perUpstreamPreconnectRatio).WillByDefault(Return(1.5));
+
+  EXPECT_CALL(pool_, instantiateActiveClient).Times(2);
+  pool_.newStreamImpl(context_);
+
+  EXPECT_CALL(pool_, onPoolReady);
+  clients_[0]->onEvent(Network::ConnectionEvent::Connected);
+  clients_[1]->onEvent(Network::ConnectionEvent::Connected);
+  EXPECT_EQ(ActiveClient::State::READY, clients_[1]->state());
+
+  time_system_.advanceTimeAndRun(std::chrono::milliseconds(999), *dispatcher_,
+                                 Event::Dispatcher::RunType::NonBlock);
+  EXPECT_CALL(pool_, instantiateActiveClient).Times(0);
+  clients_[1]->onEvent(Network::ConnectionEvent::RemoteClose);
+  CHECK_STATE(1 /*active*/, 0 /*pending*/, 0 /*connecting capacity*/);
+
+  pool_.destructAllConnections();
+}
+
 TEST_F(ConnPoolImplDispatcherBaseTest, MaxConnectionDurationTimerNull) {
   // Force a null max connection duration optional.
   // newActiveClientAndStream() will expect the connection duration timer to remain null.
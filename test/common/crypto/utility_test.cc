@@ -40,6 +40,23 @@ TEST(UtilityTest, TestSha256DigestGrowingBuffer) {
             Hex::encode(digest));
 }
 
+TEST(UtilityTest, TestSha256Hasher) {
+  auto hasher = UtilitySingleton::get().createSha256Hasher();
+  hasher->update(Buffer::OwnedImpl("slice 1"));
+  hasher->update(Buffer::OwnedImpl());
+  hasher->update(Buffer::OwnedImpl("slice 2"));
+  hasher->update(Buffer::OwnedImpl("slice 3"));
+  // Matches the digest of the same slices in a single buffer.
+  EXPECT_EQ("29606bbf02fdc40007cdf799de36d931e3587dafc086937efd6599a4ea9397aa",
+            Hex::encode(hasher->finish()));
+}
+
+TEST(UtilityTest, TestSha256HasherWithNoData) {
+  auto hasher = UtilitySingleton::get().createSha256Hasher();
+  EXPECT_EQ("e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855",
+            Hex::encode(hasher->finish()));
+}
+
 TEST(UtilityTest, TestSha256Hmac) {
   const std::string key = "key";
   auto hmac = UtilitySingleton::get().getSha256Hmac(std::vector<uint8_t>(key.begin(), key.end()),
@@ -1316,6 +1316,64 @@ TEST_F(TimerImplTest, TimerChainDelete) {
   dispatcher_->run(Dispatcher::RunType::NonBlock);
 }
 
+// Whole-second timers are armed on a libevent common timeout queue and can be moved back onto
+// the min-heap and disabled like any other timer.
+TEST_F(TimerImplTest, CommonTimeoutEnableDisable) {
+  ReadyWatcher watcher1;
+  Event::TimerPtr timer1 = dispatcher_->createTimer([&] { watcher1.ready(); });
+
+  ReadyWatcher watcher2;
+  Event::TimerPtr timer2 = dispatcher_->createTimer([&] { watcher2.ready(); });
+
+  InSequence s;
+  EXPECT_CALL(prepare_watcher_, ready());
+  EXPECT_CALL(watcher1, ready());
+  EXPECT_CALL(prepare_watcher_, ready());
+  runInEventLoop([&]() {
+    timer1->enableTimer(std::chrono::seconds(1000));
+    timer2->enableTimer(std::chrono::seconds(1000));
+    EXPECT_TRUE(timer1->enabled());
+    EXPECT_TRUE(timer2->enabled());
+    timer2->disableTimer();
+    EXPECT_FALSE(timer2->enabled());
+    timer1->enableTimer(std::chrono::milliseconds(1));
+
+    // Advance time by 10ms so timer1 triggers in this loop iteration.
+    advanceLibeventTime(absl::Milliseconds(10));
+  });
+  EXPECT_FALSE(timer1->enabled());
+  EXPECT_FALSE(timer2->enabled());
+}
+
+TEST(CommonTimeoutsTest, WholeSecondDurationsOnly) {
+  Libevent::BasePtr base(event_base_new());
+  CommonTimeouts common_timeouts(base);
+
+  EXPECT_EQ(nullptr, common_timeouts.get({0, 0}));
+  EXPECT_EQ(nullptr, common_timeouts.get({0, 5000}));
+  EXPECT_EQ(nullptr, common_timeouts.get({1, 1}));
+
+  const timeval* one_second = common_timeouts.get({1, 0});
+  ASSERT_NE(nullptr, one_second);
+  EXPECT_EQ(1, one_second->tv_sec);
+  EXPECT_EQ(one_second, common_timeouts.get({1, 0}));
+  EXPECT_NE(one_second, common_timeouts.get({2, 0}));
+}
+
+TEST(CommonTimeoutsTest, BoundedNumberOfDurations) {
+  Libevent::BasePtr base(event_base_new());
+  CommonTimeouts common_timeouts(base);
+
+  for (uint32_t i = 1; i <= CommonTimeouts::MaxCommonTimeouts; ++i) {
+    EXPECT_NE(nullptr, common_timeouts.get({static_cast<time_t>(i), 0}));
+  }
+  // New durations fall back to the min-heap once the limit is reached, while registered ones keep
+  // using their queue.
+  EXPECT_EQ(nullptr,
+            common_timeouts.get({static_cast<time_t>(CommonTimeouts::MaxCommonTimeouts + 1), 0}));
+  EXPECT_NE(nullptr, common_timeouts.get({1, 0}));
+}
+
 class TimerImplTimingTest : public testing::Test {
 public:
   std::chrono::nanoseconds getTimerTiming(Event::SimulatedTimeSystem& time_system,
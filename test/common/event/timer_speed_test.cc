@@ -0,0 +1,84 @@
+// Note: this should be run with --compilation_mode=opt, and would benefit from a
+// quiescent system with disabled cstate power management.
+
+#include <chrono>
+#include <vector>
+
+#include "envoy/event/dispatcher.h"
+#include "envoy/event/timer.h"
+
+#include "test/test_common/utility.h"
+
+#include "benchmark/benchmark.h"
+
+namespace Envoy {
+namespace Event {
+
+// Whole-second durations are armed on a libevent common timeout queue, while durations with a
+// sub-second component are armed on the min-heap. Both are 60s so that no timer fires during the
+// benchmark.
+static std::chrono::milliseconds timerDuration(bool common_timeout) {
+  return common_timeout ? std::chrono::milliseconds(60000) : std::chrono::milliseconds(60001);
+}
+
+static std::vector<TimerPtr> createTimers(Dispatcher& dispatcher, uint32_t num_timers) {
+  std::vector<TimerPtr> timers;
+  timers.reserve(num_timers);
+  for (uint32_t i = 0; i < num_timers; ++i) {
+    timers.push_back(dispatcher.createTimer([]() {}));
+  }
+  return timers;
+}
+
+// Arms and then disarms a population of timers sharing one duration, as happens when connections
+// are opened and closed.
+static void BM_TimerArmDisarm(benchmark::State& state) {
+  Api::ApiPtr api = Api::createApiForTest();
+  DispatcherPtr dispatcher = api->allocateDispatcher("test_thread");
+  const uint32_t num_timers = state.range(0);
+  const std::chrono::milliseconds duration = timerDuration(state.range(1) != 0);
+  std::vector<TimerPtr> timers = createTimers(*dispatcher, num_timers);
+
+  for (auto _ : state) {
+    for (TimerPtr& timer : timers) {
+      timer->enableTimer(duration);
+    }
+    for (TimerPtr& timer : timers) {
+      timer->disableTimer();
+    }
+  }
+}
+BENCHMARK(BM_TimerArmDisarm)
+    ->Args({1000, 0})
+    ->Args({1000, 1})
+    ->Args({100000, 0})
+    ->Args({100000, 1})
+    ->Unit(benchmark::kMicrosecond);
+
+// Re-arms already pending timers sharing one duration, as happens when idle and stream timeouts
+// are reset on activity.
+static void BM_TimerRearm(benchmark::State& state) {
+  Api::ApiPtr api = Api::createApiForTest();
+  DispatcherPtr dispatcher = api->allocateDispatcher("test_thread");
+  const uint32_t num_timers = state.range(0);
+  const std::chrono::milliseconds duration = timerDuration(state.range(1) != 0);
+  std::vector<TimerPtr> timers = createTimers(*dispatcher, num_timers);
+  for (TimerPtr& timer : timers) {
+    timer->enableTimer(duration);
+  }
+
+  for (auto _ : state) {
+    for (TimerPtr& timer : timers) {
+      timer->enableTimer(duration);
+    }
+  }
+}
+BENCHMARK(BM_TimerRearm)
+    ->Args({1000, 0})
+    ->Args({1000, 1})
+    ->Args({100000, 0})
+    ->Args({100000, 1})
+    ->Unit(benchmark::kMicrosecond);
+
+} // namespace Event
+} // namespace Envoy
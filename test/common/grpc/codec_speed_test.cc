@@ -0,0 +1,62 @@
+// Note: this should be run with --compilation_mode=opt, and would benefit from a
+// quiescent system with disabled cstate power management.
+
+#include <array>
+#include <string>
+#include <vector>
+
+#include "source/common/buffer/buffer_impl.h"
+#include "source/common/grpc/codec.h"
+
+#include "benchmark/benchmark.h"
+
+namespace Envoy {
+namespace Grpc {
+
+// Builds a stream of num_messages gRPC frames carrying message_size byte payloads, split into
+// read-sized slices as it would arrive from the network.
+static std::vector<std::string> makeStream(uint64_t num_messages, uint64_t message_size) {
+  std::string stream;
+  std::array<uint8_t, 5> header;
+  Encoder().newFrame(GRPC_FH_DEFAULT, message_size, header);
+  const std::string message(message_size, 'a');
+  for (uint64_t i = 0; i < num_messages; ++i) {
+    stream.append(reinterpret_cast<const char*>(header.data()), header.size());
+    stream.append(message);
+  }
+
+  constexpr uint64_t ReadSize = 16384;
+  std::vector<std::string> slices;
+  for (uint64_t offset = 0; offset < stream.size(); offset += ReadSize) {
+    slices.push_back(stream.substr(offset, ReadSize));
+  }
+  return slices;
+}
+
+// Decodes a streaming RPC's worth of frames, one network read at a time.
+static void BM_DecodeStream(benchmark::State& state) {
+  const uint64_t num_messages = state.range(0);
+  const uint64_t message_size = state.range(1);
+  const std::vector<std::string> slices = makeStream(num_messages, message_size);
+
+  for (auto _ : state) {
+    Decoder decoder;
+    std::vector<Frame> frames;
+    for (const std::string& slice : slices) {
+      Buffer::OwnedImpl buffer;
+      buffer.appendSliceForTest(slice);
+      decoder.decode(buffer, frames);
+    }
+    benchmark::DoNotOptimize(frames.size());
+  }
+  state.SetBytesProcessed(state.iterations() * num_messages * message_size);
+}
+BENCHMARK(BM_DecodeStream)
+    ->Args({10000, 16})
+    ->Args({10000, 256})
+    ->Args({100, 65536})
+    ->Args({10, 1048576})
+    ->Unit(benchmark::kMicrosecond);
+
+} // namespace Grpc
+} // namespace Envoy
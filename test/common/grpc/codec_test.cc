@@ -221,6 +221,100 @@ TEST(GrpcCodecTest, decodeMultipleFrame) {
   }
 }
 
+// Payload slices that are fully covered by a frame are handed over to the frame without being
+// copied.
+TEST(GrpcCodecTest, decodeFrameSpanningSlices) {
+  const std::string payload_slice1(16384, 'a');
+  const std::string payload_slice2(16384, 'b');
+
+  Buffer::OwnedImpl buffer;
+  std::array<uint8_t, 5> header;
+  Encoder encoder;
+  encoder.newFrame(GRPC_FH_DEFAULT, payload_slice1.size() + payload_slice2.size(), header);
+  buffer.appendSliceForTest(header.data(), 5);
+  buffer.appendSliceForTest(payload_slice1);
+  buffer.appendSliceForTest(payload_slice2);
+  const Buffer::RawSliceVector input_slices = buffer.getRawSlices();
+  ASSERT_EQ(3, input_slices.size());
+
+  std::vector<Frame> frames;
+  Decoder decoder;
+  EXPECT_TRUE(decoder.decode(buffer, frames));
+  EXPECT_EQ(0, buffer.length());
+  ASSERT_EQ(1, frames.size());
+  EXPECT_EQ(payload_slice1.size() + payload_slice2.size(), frames[0].length_);
+
+  const Buffer::RawSliceVector frame_slices = frames[0].data_->getRawSlices();
+  ASSERT_EQ(2, frame_slices.size());
+  EXPECT_EQ(input_slices[1].mem_, frame_slices[0].mem_);
+  EXPECT_EQ(input_slices[2].mem_, frame_slices[1].mem_);
+  EXPECT_EQ(payload_slice1 + payload_slice2, frames[0].data_->toString());
+}
+
+// Frames whose headers and payloads are split across slices and decode() calls at arbitrary
+// points are reassembled correctly.
+TEST(GrpcCodecTest, decodeFramesSplitAcrossSlicesAndCalls) {
+  std::string input;
+  std::vector<std::string> messages;
+  std::array<uint8_t, 5> header;
+  Encoder encoder;
+  for (int i = 0; i < 20; i++) {
+    messages.push_back(std::string(i * 7, static_cast<char>('a' + i)));
+    encoder.newFrame(GRPC_FH_DEFAULT, messages.back().size(), header);
+    input.append(reinterpret_cast<const char*>(header.data()), header.size());
+    input.append(messages.back());
+  }
+
+  for (const size_t chunk_size : {1, 3, 5, 11, 64, 1000}) {
+    std::vector<Frame> frames;
+    Decoder decoder;
+    for (size_t offset = 0; offset < input.size(); offset += 3 * chunk_size) {
+      // Build each decode() input out of several slices.
+      Buffer::OwnedImpl buffer;
+      for (size_t slice_offset = offset;
+           slice_offset < std::min(input.size(), offset + 3 * chunk_size);
+           slice_offset += chunk_size) {
+        buffer.appendSliceForTest(absl::string_view(input).substr(
+            slice_offset, std::min(chunk_size, offset + 3 * chunk_size - slice_offset)));
+      }
+      EXPECT_TRUE(decoder.decode(buffer, frames));
+      EXPECT_EQ(0, buffer.length());
+    }
+    EXPECT_FALSE(decoder.hasBufferedData());
+    ASSERT_EQ(messages.size(), frames.size());
+    for (size_t i = 0; i < messages.size(); i++) {
+      EXPECT_EQ(messages[i].size(), frames[i].length_);
+      EXPECT_EQ(messages[i], frames[i].data_->toString());
+    }
+  }
+}
+
+// Slices that alias the same memory, such as one fragment added twice, decode into separate
+// frames in input order.
+TEST(GrpcCodecTest, decodeFramesFromAliasedSlices) {
+  const std::string message = "hello";
+  std::array<uint8_t, 5> header;
+  Encoder().newFrame(GRPC_FH_DEFAULT, message.size(), header);
+  std::string frame(reinterpret_cast<const char*>(header.data()), header.size());
+  frame.append(message);
+
+  Buffer::BufferFragmentImpl fragment(frame.data(), frame.size(), nullptr);
+  Buffer::OwnedImpl buffer;
+  buffer.addBufferFragment(fragment);
+  buffer.addBufferFragment(fragment);
+  ASSERT_EQ(2, buffer.getRawSlices().size());
+
+  std::vector<Frame> frames;
+  Decoder decoder;
+  EXPECT_TRUE(decoder.decode(buffer, frames));
+  EXPECT_EQ(0, buffer.length());
+  ASSERT_EQ(2, frames.size());
+  for (const Frame& decoded : frames) {
+    EXPECT_EQ(message.size(), decoded.length_);
+    EXPECT_EQ(message, decoded.data_->toString());
+  }
+}
+
 TEST(GrpcCodecTest, FrameInspectorTest) {
   {
     Buffer::OwnedImpl buffer;
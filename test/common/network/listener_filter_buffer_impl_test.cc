@@ -0,0 +1,139 @@
+#include <cstring>
+
+#include "source/common/network/io_socket_error_impl.h"
+#include "source/common/network/listener_filter_buffer_impl.h"
+
+#include "test/mocks/network/io_handle.h"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+using testing::_;
+using testing::ByMove;
+using testing::Invoke;
+using testing::Return;
+
+namespace Envoy {
+namespace Network {
+namespace {
+
+Api::IoCallUint64Result peekResult(absl::string_view data, void* buffer, size_t length) {
+  const size_t copied = std::min(data.size(), length);
+  memcpy(buffer, data.data(), copied);
+  return {copied, Api::IoErrorPtr(nullptr, IoSocketError::deleteIoError)};
+}
+
+Api::IoCallUint64Result againResult() {
+  return {0, Api::IoErrorPtr(IoSocketError::getIoSocketEagainInstance(),
+                             IoSocketError::deleteIoError)};
+}
+
+class ListenerFilterBufferImplTest : public testing::Test {
+public:
+  void expectPeek(absl::string_view data) {
+    EXPECT_CALL(io_handle_, recv(_, _, MSG_PEEK))
+        .WillOnce(Invoke([data](void* buffer, size_t length, int) {
+          return peekResult(data, buffer, length);
+        }));
+  }
+
+  MockIoHandle io_handle_;
+  ListenerFilterBufferImpl buffer_{io_handle_};
+};
+
+// Data that was peeked at completely is returned again until the socket becomes readable.
+TEST_F(ListenerFilterBufferImplTest, PeekedDataSharedUntilReadable) {
+  expectPeek("hello");
+  auto result = buffer_.peek(16);
+  ASSERT_TRUE(result.ok());
+  EXPECT_EQ(5, result.return_value_);
+  EXPECT_EQ("hello", buffer_.peekedData());
+
+  // A second listener filter sees the same data without another peek.
+  result = buffer_.peek(8);
+  ASSERT_TRUE(result.ok());
+  EXPECT_EQ(5, result.return_value_);
+  result = buffer_.peek(3);
+  ASSERT_TRUE(result.ok());
+  EXPECT_EQ(3, result.return_value_);
+
+  buffer_.onSocketReadable();
+  expectPeek("hello world");
+  result = buffer_.peek(16);
+  ASSERT_TRUE(result.ok());
+  EXPECT_EQ(11, result.return_value_);
+  EXPECT_EQ("hello world", buffer_.peekedData());
+}
+
+// A peek that was truncated is repeated when more data is requested.
+TEST_F(ListenerFilterBufferImplTest, TruncatedPeek) {
+  expectPeek("hello");
+  auto result = buffer_.peek(2);
+  ASSERT_TRUE(result.ok());
+  EXPECT_EQ(2, result.return_value_);
+  EXPECT_EQ("he", buffer_.peekedData());
+
+  result = buffer_.peek(1);
+  ASSERT_TRUE(result.ok());
+  EXPECT_EQ(1, result.return_value_);
+
+  expectPeek("hello");
+  result = buffer_.peek(16);
+  ASSERT_TRUE(result.ok());
+  EXPECT_EQ(5, result.return_value_);
+  EXPECT_EQ("hello", buffer_.peekedData());
+}
+
+// Data consumed from the socket is removed from the front of the peeked data.
+TEST_F(ListenerFilterBufferImplTest, Read) {
+  expectPeek("hello");
+  ASSERT_TRUE(buffer_.peek(16).ok());
+
+  char data[2];
+  EXPECT_CALL(io_handle_, recv(_, 2, 0)).WillOnce(Invoke([](void* buffer, size_t length, int) {
+    return peekResult("hello", buffer, length);
+  }));
+  auto result = buffer_.read(data, 2);
+  ASSERT_TRUE(result.ok());
+  EXPECT_EQ(2, result.return_value_);
+  EXPECT_EQ("llo", buffer_.peekedData());
+
+  result = buffer_.peek(16);
+  ASSERT_TRUE(result.ok());
+  EXPECT_EQ(3, result.return_value_);
+}
+
+// Nothing is cached when the socket has no data yet.
+TEST_F(ListenerFilterBufferImplTest, PeekAgain) {
+  EXPECT_CALL(io_handle_, recv(_, 16, MSG_PEEK)).WillOnce(Return(ByMove(againResult())));
+  EXPECT_TRUE(buffer_.peek(16).wouldBlock());
+  EXPECT_TRUE(buffer_.peekedData().empty());
+
+  expectPeek("hello");
+  auto result = buffer_.peek(16);
+  ASSERT_TRUE(result.ok());
+  EXPECT_EQ(5, result.return_value_);
+}
+
+// Peeks of other connections on the same thread do not change the data peeked by a connection.
+TEST_F(ListenerFilterBufferImplTest, PeekedDataOwnedByConnection) {
+  expectPeek("hello");
+  ASSERT_TRUE(buffer_.peek(16).ok());
+
+  MockIoHandle other_io_handle;
+  ListenerFilterBufferImpl other_buffer{other_io_handle};
+  EXPECT_CALL(other_io_handle, recv(_, 32, MSG_PEEK))
+      .WillOnce(Invoke([](void* buffer, size_t length, int) {
+        return peekResult("other connection", buffer, length);
+      }));
+  auto result = other_buffer.peek(32);
+  ASSERT_TRUE(result.ok());
+  EXPECT_EQ(16, result.return_value_);
+
+  EXPECT_EQ("hello", buffer_.peekedData());
+  EXPECT_EQ("other connection", other_buffer.peekedData());
+}
+
+} // namespace
+} // namespace Network
+} // namespace Envoy
@@ -156,6 +156,45 @@ TEST_F(AllocatorImplTest, RefCountDecAllocRaceSynchronized) {
   EXPECT_FALSE(alloc_.isMutexLockedForTest());
 }
 
+// Tests that concurrently taking and releasing extra references to a stat,
+// which does not take the allocator's lock, leaves the ref-count consistent so
+// that the final release still removes the stat.
+TEST_F(AllocatorImplTest, RefCountDecWithoutDeleteRace) {
+  StatName counter_name = makeStat("counter.name");
+  Thread::ThreadFactory& thread_factory = Thread::threadFactoryForTest();
+  CounterSharedPtr counter = alloc_.makeCounter(counter_name, StatName(), {});
+
+  const uint32_t num_threads = 12;
+  const uint32_t iters = 10000;
+  std::vector<Thread::ThreadPtr> threads;
+  absl::Notification go;
+  for (uint32_t i = 0; i < num_threads; ++i) {
+    threads.push_back(thread_factory.createThread([&]() {
+      go.WaitForNotification();
+      for (uint32_t j = 0; j < iters; ++j) {
+        CounterSharedPtr copy = counter;
+        copy->inc();
+      }
+    }));
+  }
+  go.Notify();
+  for (uint32_t i = 0; i < num_threads; ++i) {
+    threads[i]->join();
+  }
+
+  EXPECT_EQ(1, counter->use_count());
+  EXPECT_EQ(num_threads * iters, counter->value());
+  size_t num_counters = 0;
+  alloc_.forEachCounter([&num_counters](std::size_t size) { num_counters = size; },
+                        [](Stats::Counter&) {});
+  EXPECT_EQ(1, num_counters);
+
+  counter.reset();
+  alloc_.forEachCounter([&num_counters](std::size_t size) { num_counters = size; },
+                        [](Stats::Counter&) {});
+  EXPECT_EQ(0, num_counters);
+}
+
 TEST_F(AllocatorImplTest, ForEachCounter) {
   StatNameHashSet stat_names;
   std::vector<CounterSharedPtr> counters;
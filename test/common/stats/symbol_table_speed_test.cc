@@ -61,6 +61,49 @@ static void bmCreateRace(benchmark::State& state) {
 }
 BENCHMARK(bmCreateRace)->Unit(::benchmark::kMillisecond);
 
+// Measures contention on the symbol table when many threads copy (incRefCount)
+// and release (free) StatNames for symbols that already exist, which is what
+// happens when workers create stats from existing StatNames. The argument is
+// the number of threads.
+// NOLINTNEXTLINE(readability-identifier-naming)
+static void bmCopyRace(benchmark::State& state) {
+  const int num_threads = state.range(0);
+  for (auto _ : state) {
+    UNREFERENCED_PARAMETER(_);
+    Envoy::Thread::ThreadFactory& thread_factory = Envoy::Thread::threadFactoryForTest();
+
+    std::vector<Envoy::Thread::ThreadPtr> threads;
+    threads.reserve(num_threads);
+    Envoy::ConditionalInitializer access;
+    absl::BlockingCounter accesses(num_threads);
+    Envoy::Stats::SymbolTableImpl table;
+    Envoy::Stats::StatNameStorage initial("cluster.service_a.upstream_rq_total", table);
+    const Envoy::Stats::StatName stat_name = initial.statName();
+
+    for (int i = 0; i < num_threads; ++i) {
+      threads.push_back(thread_factory.createThread([&access, &accesses, &table, stat_name]() {
+        access.wait();
+
+        for (int count = 0; count < 10000; ++count) {
+          Envoy::Stats::StatNameStorage copy(stat_name, table);
+          copy.free(table);
+        }
+        accesses.DecrementCount();
+      }));
+    }
+
+    access.setReady();
+    accesses.Wait();
+
+    for (auto& thread : threads) {
+      thread->join();
+    }
+
+    initial.free(table);
+  }
+}
+BENCHMARK(bmCopyRace)->Arg(1)->Arg(4)->Arg(16)->Arg(64)->Unit(::benchmark::kMillisecond);
+
 // NOLINTNEXTLINE(readability-identifier-naming)
 static void bmJoinStatNames(benchmark::State& state) {
   Envoy::Stats::SymbolTableImpl symbol_table;
@@ -106,6 +106,25 @@ void BM_ExtractTags(benchmark::State& state) {
 }
 BENCHMARK(BM_ExtractTags)->DenseRange(0, 26, 1);
 
+// Runs every stat name above through the default extractors, which approximates the mix of names
+// whose tags are produced when a large number of stats are created.
+// NOLINTNEXTLINE(readability-identifier-naming)
+void BM_ExtractTagsAllNames(benchmark::State& state) {
+  TagProducerImpl tag_extractors{envoy::config::metrics::v3::StatsConfig()};
+  TagVector tags;
+  for (auto _ : state) {
+    UNREFERENCED_PARAMETER(_);
+    for (const auto& p : params) {
+      tags.clear();
+      tag_extractors.produceTags(std::get<0>(p), tags);
+      RELEASE_ASSERT(tags.size() == std::get<1>(p),
+                     absl::StrCat("tags.size()=", tags.size(), " tags_size==", std::get<1>(p)));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * params.size());
+}
+BENCHMARK(BM_ExtractTagsAllNames);
+
 } // namespace
 } // namespace Stats
 } // namespace Envoy
@@ -2667,6 +2667,25 @@ TEST_F(ClusterInfoImplTest, Metadata) {
   EXPECT_EQ(LoadBalancerType::Maglev, cluster->info()->lbType());
 }
 
+// Load report stats are created on first use, start at zero and are kept out of the cluster's
+// stats scope.
+TEST_F(ClusterInfoImplTest, LoadReportStats) {
+  const std::string yaml = R"EOF(
+    name: name
+    connect_timeout: 0.25s
+    type: STRICT_DNS
+    lb_policy: ROUND_ROBIN
+  )EOF";
+
+  auto cluster = makeCluster(yaml);
+  ClusterLoadReportStats& load_report_stats = cluster->info()->loadReportStats();
+  EXPECT_EQ(0, load_report_stats.upstream_rq_dropped_.value());
+  load_report_stats.upstream_rq_dropped_.add(3);
+  EXPECT_EQ(&load_report_stats, &cluster->info()->loadReportStats());
+  EXPECT_EQ(3, cluster->info()->loadReportStats().upstream_rq_dropped_.latch());
+  EXPECT_FALSE(stats_.findCounterByString("cluster.name.upstream_rq_dropped").has_value());
+}
+
 // Verify retry budget default values are honored.
 TEST_F(ClusterInfoImplTest, RetryBudgetDefaultPopulation) {
   std::string yaml = R"EOF(
@@ -183,8 +183,7 @@ TEST_F(GrpcAccessLogTest, BasicFlow) {
   expectFlushedLogEntriesCount(stream, MOCK_TCP_LOG_FIELD_NAME, 1);
   logger_->log(ProtobufWkt::Empty());
   EXPECT_EQ(2, logger_->numClears());
-  // TCP logging doesn't change the logs_written counter.
-  EXPECT_EQ(1,
+  EXPECT_EQ(2,
             TestUtility::findCounter(stats_store_, "mock_access_log_prefix.logs_written")->value());
 
   // Verify that sending an empty response message doesn't do anything bad.
@@ -202,7 +201,7 @@ TEST_F(GrpcAccessLogTest, BasicFlow) {
   EXPECT_EQ(3, logger_->numClears());
   EXPECT_EQ(0,
             TestUtility::findCounter(stats_store_, "mock_access_log_prefix.logs_dropped")->value());
-  EXPECT_EQ(2,
+  EXPECT_EQ(3,
             TestUtility::findCounter(stats_store_, "mock_access_log_prefix.logs_written")->value());
 }
 
@@ -253,6 +252,32 @@ TEST_F(GrpcAccessLogTest, WatermarksOverrun) {
             TestUtility::findCounter(stats_store_, "mock_access_log_prefix.logs_dropped")->value());
 }
 
+// Test that TCP entries are bounded by the buffer size and dropped while the stream is backed up.
+TEST_F(GrpcAccessLogTest, TcpWatermarksOverrun) {
+  InSequence s;
+  initLogger(FlushInterval, 1);
+
+  MockAccessLogStream stream;
+  AccessLogCallbacks* callbacks;
+  expectStreamStart(stream, &callbacks);
+
+  // Fail to flush, so the log stays buffered up and fills the buffer.
+  EXPECT_CALL(stream, isAboveWriteBufferHighWatermark()).WillOnce(Return(true));
+  EXPECT_CALL(stream, sendMessageRaw_(_, false)).Times(0);
+  logger_->log(mockHttpEntry());
+  EXPECT_EQ(0, logger_->numClears());
+
+  // The buffer is still full, so the TCP entry is dropped.
+  EXPECT_CALL(stream, isAboveWriteBufferHighWatermark()).WillOnce(Return(true));
+  EXPECT_CALL(stream, sendMessageRaw_(_, _)).Times(0);
+  logger_->log(ProtobufWkt::Empty());
+  EXPECT_EQ(0, logger_->numClears());
+  EXPECT_EQ(1,
+            TestUtility::findCounter(stats_store_, "mock_access_log_prefix.logs_written")->value());
+  EXPECT_EQ(1,
+            TestUtility::findCounter(stats_store_, "mock_access_log_prefix.logs_dropped")->value());
+}
+
 // Test that stream failure is handled correctly.
 TEST_F(GrpcAccessLogTest, StreamFailure) {
   initLogger(FlushInterval, 0);
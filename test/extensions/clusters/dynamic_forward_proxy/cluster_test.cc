@@ -152,6 +152,19 @@ cluster_type:
       dns_lookup_family: AUTO
 )EOF";
 
+  const std::string batched_host_set_config_ = R"EOF(
+name: name
+connect_timeout: 0.25s
+cluster_type:
+  name: dynamic_forward_proxy
+  typed_config:
+    "@type": type.googleapis.com/envoy.extensions.clusters.dynamic_forward_proxy.v3.ClusterConfig
+    host_set_update_interval: 1s
+    dns_cache_config:
+      name: foo
+      dns_lookup_family: AUTO
+)EOF";
+
   const std::string coalesce_connection_config_ = R"EOF(
 name: name
 connect_timeout: 0.25s
@@ -201,6 +214,52 @@ TEST_F(ClusterTest, BasicFlow) {
   EXPECT_EQ(nullptr, lb_->chooseHost(setHostAndReturnContext("host1")));
 }
 
+// With host_set_update_interval, the LB finds new hosts immediately while host set changes are
+// applied in batches.
+TEST_F(ClusterTest, BatchedHostSetUpdates) {
+  Event::MockTimer* host_set_update_timer = new Event::MockTimer(&dispatcher_);
+  initialize(batched_host_set_config_, false);
+  makeTestHost("host1", "1.2.3.4");
+  makeTestHost("host2", "1.2.3.5");
+  makeTestHost("host3", "1.2.3.6");
+  InSequence s;
+
+  // The hosts can be chosen as soon as they are added, before the host set is updated.
+  EXPECT_CALL(*host_set_update_timer, enableTimer(std::chrono::milliseconds(1000), _));
+  update_callbacks_->onDnsHostAddOrUpdate("host1", host_map_["host1"]);
+  update_callbacks_->onDnsHostAddOrUpdate("host2", host_map_["host2"]);
+  update_callbacks_->onDnsHostAddOrUpdate("host3", host_map_["host3"]);
+  EXPECT_EQ(0UL, cluster_->prioritySet().hostSetsPerPriority()[0]->hosts().size());
+  EXPECT_CALL(*host_map_["host1"], touch());
+  EXPECT_EQ("1.2.3.4:0", lb_->chooseHost(setHostAndReturnContext("host1"))->address()->asString());
+
+  // A host removed before the batch is applied never enters the host set, but it is still reported
+  // as removed so that connection pools created for it are drained.
+  EXPECT_CALL(*host_map_["host3"], touch());
+  Upstream::HostConstSharedPtr host3 = lb_->chooseHost(setHostAndReturnContext("host3"));
+  ASSERT_NE(nullptr, host3);
+  update_callbacks_->onDnsHostRemove("host3");
+  EXPECT_EQ(nullptr, lb_->chooseHost(setHostAndReturnContext("host3")));
+
+  EXPECT_CALL(*this, onMemberUpdateCb(SizeIs(3), SizeIs(1)))
+      .WillOnce(Invoke([&](const Upstream::HostVector&, const Upstream::HostVector& hosts_removed) {
+        EXPECT_EQ(host3, hosts_removed[0]);
+      }));
+  host_set_update_timer->invokeCallback();
+  EXPECT_EQ(2UL, cluster_->prioritySet().hostSetsPerPriority()[0]->hosts().size());
+
+  EXPECT_CALL(*host_set_update_timer, enableTimer(std::chrono::milliseconds(1000), _));
+  update_callbacks_->onDnsHostRemove("host1");
+  EXPECT_EQ(nullptr, lb_->chooseHost(setHostAndReturnContext("host1")));
+  EXPECT_EQ(2UL, cluster_->prioritySet().hostSetsPerPriority()[0]->hosts().size());
+
+  EXPECT_CALL(*this, onMemberUpdateCb(SizeIs(0), SizeIs(1)));
+  host_set_update_timer->invokeCallback();
+  EXPECT_EQ(1UL, cluster_->prioritySet().hostSetsPerPriority()[0]->hosts().size());
+  EXPECT_EQ("1.2.3.5:0",
+            cluster_->prioritySet().hostSetsPerPriority()[0]->hosts()[0]->address()->asString());
+}
+
 // Various invalid LB context permutations in case the cluster is used outside of HTTP.
 TEST_F(ClusterTest, InvalidLbContext) {
   initialize(default_yaml_config_, false);
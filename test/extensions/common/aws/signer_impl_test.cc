@@ -64,6 +64,24 @@ public:
               headers.get(SignatureHeaders::get().ContentSha256)[0]->value().getStringView());
   }
 
+  // Returns the authorization header for a simple request signed by the given signer.
+  std::string signedAuthorization(SignerImpl& signer) {
+    Http::TestRequestHeaderMapImpl headers{{":method", "GET"}, {":path", "/"}};
+    signer.signEmptyPayload(headers);
+    return std::string(
+        headers.get(Http::CustomHeaders::get().Authorization)[0]->value().getStringView());
+  }
+
+  // Returns the authorization header for the same request signed by a newly created signer, which
+  // has to derive its signing key from the given credentials.
+  std::string uncachedAuthorization(const Credentials& credentials) {
+    auto* credentials_provider = new NiceMock<MockCredentialsProvider>();
+    EXPECT_CALL(*credentials_provider, getCredentials()).WillOnce(Return(credentials));
+    SignerImpl signer("service", "region", CredentialsProviderSharedPtr{credentials_provider},
+                      time_system_, Extensions::Common::Aws::AwsSigV4HeaderExclusionVector{});
+    return signedAuthorization(signer);
+  }
+
   NiceMock<MockCredentialsProvider>* credentials_provider_;
   Event::SimulatedTimeSystem time_system_;
   Http::RequestMessagePtr message_;
@@ -216,6 +234,30 @@ TEST_F(SignerImplTest, SignHeadersByService) {
                     SignatureConstants::get().UnsignedPayload, true);
 }
 
+// Verify the cached signing key is replaced when the credentials rotate or the date changes.
+TEST_F(SignerImplTest, SigningKeyCache) {
+  const Credentials rotated_credentials("akid", "rotated_secret");
+  EXPECT_CALL(*credentials_provider_, getCredentials())
+      .WillOnce(Return(credentials_))
+      .WillOnce(Return(credentials_))
+      .WillOnce(Return(rotated_credentials))
+      .WillOnce(Return(rotated_credentials));
+
+  const std::string authorization = signedAuthorization(signer_);
+  EXPECT_EQ(uncachedAuthorization(credentials_), authorization);
+  EXPECT_EQ(authorization, signedAuthorization(signer_));
+
+  const std::string rotated_authorization = signedAuthorization(signer_);
+  EXPECT_NE(authorization, rotated_authorization);
+  EXPECT_EQ(uncachedAuthorization(rotated_credentials), rotated_authorization);
+
+  // 20180103T030405Z
+  time_system_.setSystemTime(std::chrono::milliseconds(1514948645000));
+  const std::string next_day_authorization = signedAuthorization(signer_);
+  EXPECT_NE(rotated_authorization, next_day_authorization);
+  EXPECT_EQ(uncachedAuthorization(rotated_credentials), next_day_authorization);
+}
+
 } // namespace
 } // namespace Aws
 } // namespace Common
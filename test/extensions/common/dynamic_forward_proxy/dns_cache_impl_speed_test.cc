@@ -0,0 +1,105 @@
+// Note: this should be run with --compilation_mode=opt, and would benefit from a
+// quiescent system with disabled cstate power management.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "envoy/config/cluster/v3/cluster.pb.h"
+#include "envoy/extensions/common/dynamic_forward_proxy/v3/dns_cache.pb.h"
+
+#include "source/common/network/utility.h"
+#include "source/extensions/common/dynamic_forward_proxy/dns_cache_impl.h"
+
+#include "test/extensions/common/dynamic_forward_proxy/mocks.h"
+#include "test/mocks/network/mocks.h"
+#include "test/mocks/server/factory_context.h"
+#include "test/test_common/registry.h"
+
+#include "benchmark/benchmark.h"
+
+using testing::_;
+using testing::Invoke;
+using testing::NiceMock;
+using testing::Return;
+
+namespace Envoy {
+namespace Extensions {
+namespace Common {
+namespace DynamicForwardProxy {
+
+constexpr uint32_t NumHosts = 1000;
+
+// A DNS cache holding NumHosts resolved hosts, shared by all of the benchmark threads which stand
+// in for the worker threads.
+struct DnsCacheContext {
+  DnsCacheContext() : registered_dns_factory_(dns_resolver_factory_) {
+    envoy::extensions::common::dynamic_forward_proxy::v3::DnsCacheConfig config;
+    config.set_name("foo");
+    config.set_dns_lookup_family(envoy::config::cluster::v3::Cluster::V4_ONLY);
+    config.mutable_max_hosts()->set_value(NumHosts);
+    for (uint32_t i = 0; i < NumHosts; ++i) {
+      hosts_.push_back(absl::StrCat("host", i, ".example.com"));
+      auto* address = config.add_preresolve_hostnames();
+      address->set_address(hosts_.back());
+      address->set_port_value(443);
+    }
+
+    ON_CALL(context_.dispatcher_, isThreadSafe).WillByDefault(Return(true));
+    ON_CALL(dns_resolver_factory_, createDnsResolver(_, _, _)).WillByDefault(Return(resolver_));
+    ON_CALL(*resolver_, resolve(_, _, _))
+        .WillByDefault(Invoke([this](const std::string&, Network::DnsLookupFamily,
+                                     Network::DnsResolver::ResolveCb callback) {
+          resolve_callbacks_.push_back(std::move(callback));
+          return &resolver_->active_query_;
+        }));
+    dns_cache_ = std::make_unique<DnsCacheImpl>(context_, config);
+
+    for (auto& callback : resolve_callbacks_) {
+      std::list<Network::DnsResponse> response;
+      response.emplace_back(Network::Utility::parseInternetAddress("10.0.0.1"),
+                            std::chrono::seconds(60));
+      callback(Network::DnsResolver::ResolutionStatus::Success, std::move(response));
+    }
+  }
+
+  NiceMock<Server::Configuration::MockFactoryContext> context_;
+  std::shared_ptr<NiceMock<Network::MockDnsResolver>> resolver_{
+      std::make_shared<NiceMock<Network::MockDnsResolver>>()};
+  NiceMock<Network::MockDnsResolverFactory> dns_resolver_factory_;
+  Registry::InjectFactory<Network::DnsResolverFactory> registered_dns_factory_;
+  std::vector<std::string> hosts_;
+  std::vector<Network::DnsResolver::ResolveCb> resolve_callbacks_;
+  std::unique_ptr<DnsCacheImpl> dns_cache_;
+};
+
+static DnsCacheContext* context;
+
+// Measures looking up resolved hosts from many workers at once, which every request proxied to a
+// cached host does before it can be forwarded.
+static void BM_LoadCachedHost(benchmark::State& state) {
+  if (state.thread_index == 0) {
+    context = new DnsCacheContext();
+  }
+  NiceMock<MockLoadDnsCacheEntryCallbacks> callbacks;
+  uint32_t next_host = state.thread_index;
+
+  // The context is only guaranteed to be set up once all threads enter the benchmark loop.
+  for (auto _ : state) {
+    UNREFERENCED_PARAMETER(_);
+    const std::string& host = context->hosts_[next_host++ % NumHosts];
+    auto result = context->dns_cache_->loadDnsCacheEntry(host, 443, callbacks);
+    benchmark::DoNotOptimize(result.host_info_);
+  }
+
+  if (state.thread_index == 0) {
+    delete context;
+    context = nullptr;
+  }
+}
+BENCHMARK(BM_LoadCachedHost)->ThreadRange(1, 64)->UseRealTime();
+
+} // namespace DynamicForwardProxy
+} // namespace Common
+} // namespace Extensions
+} // namespace Envoy
@@ -21,9 +21,12 @@
 #include "test/test_common/test_runtime.h"
 #include "test/test_common/utility.h"
 
+#include "absl/container/flat_hash_set.h"
+
 using testing::AtLeast;
 using testing::DoAll;
 using testing::InSequence;
+using testing::Invoke;
 using testing::Return;
 using testing::SaveArg;
 
@@ -887,6 +890,46 @@ TEST_F(DnsCacheImplTest, MaxHostOverflow) {
   EXPECT_EQ(1, TestUtility::findCounter(context_.scope_, "dns_cache.foo.host_overflow")->value());
 }
 
+// Hosts are spread across the cache shards, but are looked up, iterated and counted against
+// max_hosts as a single cache.
+TEST_F(DnsCacheImplTest, ManyHosts) {
+  std::vector<std::string> hostnames;
+  for (int i = 0; i < 64; ++i) {
+    hostnames.push_back(absl::StrCat("host", i, ".example.com"));
+  }
+  std::vector<Network::DnsResolver::ResolveCb> resolve_cbs;
+  EXPECT_CALL(*resolver_, resolve(_, _, _))
+      .Times(hostnames.size())
+      .WillRepeatedly(Invoke([&](const std::string&, Network::DnsLookupFamily,
+                                 Network::DnsResolver::ResolveCb callback) {
+        resolve_cbs.push_back(std::move(callback));
+        return &resolver_->active_query_;
+      }));
+  EXPECT_CALL(update_callbacks_, onDnsHostAddOrUpdate(_, _)).Times(hostnames.size());
+
+  initialize(hostnames /* preresolve_hostnames */, hostnames.size() /* max_hosts */);
+  for (auto& resolve_cb : resolve_cbs) {
+    resolve_cb(Network::DnsResolver::ResolutionStatus::Success,
+               TestUtility::makeDnsResponse({"10.0.0.1"}));
+  }
+
+  MockLoadDnsCacheEntryCallbacks callbacks;
+  for (const auto& hostname : hostnames) {
+    auto result = dns_cache_->loadDnsCacheEntry(hostname, 80, callbacks);
+    EXPECT_EQ(DnsCache::LoadDnsCacheEntryStatus::InCache, result.status_);
+    EXPECT_NE(absl::nullopt, dns_cache_->getHost(hostname));
+  }
+
+  absl::flat_hash_set<std::string> iterated_hosts;
+  dns_cache_->iterateHostMap(
+      [&](absl::string_view host, const DnsHostInfoSharedPtr&) { iterated_hosts.emplace(host); });
+  EXPECT_EQ(hostnames.size(), iterated_hosts.size());
+
+  auto result = dns_cache_->loadDnsCacheEntry("foo.com", 80, callbacks);
+  EXPECT_EQ(DnsCache::LoadDnsCacheEntryStatus::Overflow, result.status_);
+  EXPECT_EQ(1, TestUtility::findCounter(context_.scope_, "dns_cache.foo.host_overflow")->value());
+}
+
 TEST_F(DnsCacheImplTest, CircuitBreakersNotInvoked) {
   initialize();
 
@@ -50,6 +50,29 @@ public:
 
   void TearDown() override { filter_.reset(); }
 
+  // Recreates the filter with a named controller, which routes configured with the given controller
+  // name select.
+  void setUpNamedController(const std::string& route_controller_name) {
+    auto named_controllers = std::make_shared<NamedConcurrencyControllers>();
+    named_controllers->emplace("expensive", named_controller_);
+
+    const envoy::extensions::filters::http::adaptive_concurrency::v3::AdaptiveConcurrency config;
+    auto config_ptr = std::make_shared<AdaptiveConcurrencyFilterConfig>(
+        config, runtime_, "testprefix.", stats_, time_system_);
+    filter_ = std::make_unique<AdaptiveConcurrencyFilter>(config_ptr, controller_,
+                                                          std::move(named_controllers));
+    filter_->setDecoderFilterCallbacks(decoder_callbacks_);
+    filter_->setEncoderFilterCallbacks(encoder_callbacks_);
+
+    envoy::extensions::filters::http::adaptive_concurrency::v3::AdaptiveConcurrencyPerRoute
+        route_proto;
+    route_proto.set_controller_name(route_controller_name);
+    route_config_ = std::make_unique<AdaptiveConcurrencyRouteConfig>(route_proto);
+    ON_CALL(*decoder_callbacks_.route_,
+            mostSpecificPerFilterConfig("envoy.filters.http.adaptive_concurrency"))
+        .WillByDefault(Return(route_config_.get()));
+  }
+
   envoy::extensions::filters::http::adaptive_concurrency::v3::AdaptiveConcurrency
   makeConfig(const std::string& yaml_config) {
     envoy::extensions::filters::http::adaptive_concurrency::v3::AdaptiveConcurrency proto;
@@ -61,6 +84,8 @@ public:
   Stats::IsolatedStoreImpl stats_;
   NiceMock<Runtime::MockLoader> runtime_;
   std::shared_ptr<MockConcurrencyController> controller_{new MockConcurrencyController()};
+  std::shared_ptr<MockConcurrencyController> named_controller_{new MockConcurrencyController()};
+  std::unique_ptr<AdaptiveConcurrencyRouteConfig> route_config_;
   NiceMock<Http::MockStreamDecoderFilterCallbacks> decoder_callbacks_;
   NiceMock<Http::MockStreamEncoderFilterCallbacks> encoder_callbacks_;
   std::unique_ptr<AdaptiveConcurrencyFilter> filter_;
@@ -370,6 +395,46 @@ TEST_F(AdaptiveConcurrencyFilterTest, DisregardHealthChecks) {
   filter_->encodeComplete();
 }
 
+TEST_F(AdaptiveConcurrencyFilterTest, RouteSelectsNamedController) {
+  setUpNamedController("expensive");
+
+  // Only the controller selected by the route is consulted and sampled.
+  EXPECT_CALL(*controller_, forwardingDecision()).Times(0);
+  EXPECT_CALL(*named_controller_, forwardingDecision())
+      .WillOnce(Return(RequestForwardingAction::Forward));
+  Http::TestRequestHeaderMapImpl request_headers;
+  EXPECT_EQ(Http::FilterHeadersStatus::Continue, filter_->decodeHeaders(request_headers, true));
+
+  EXPECT_CALL(*named_controller_, recordLatencySample(_));
+  filter_->encodeComplete();
+}
+
+TEST_F(AdaptiveConcurrencyFilterTest, RouteSelectsNamedControllerCancelSample) {
+  setUpNamedController("expensive");
+
+  EXPECT_CALL(*named_controller_, forwardingDecision())
+      .WillOnce(Return(RequestForwardingAction::Forward));
+  Http::TestRequestHeaderMapImpl request_headers;
+  EXPECT_EQ(Http::FilterHeadersStatus::Continue, filter_->decodeHeaders(request_headers, true));
+
+  // The sample is cancelled on the selected controller if the stream does not complete.
+  EXPECT_CALL(*named_controller_, cancelLatencySample());
+  EXPECT_CALL(*named_controller_, recordLatencySample(_)).Times(0);
+  filter_->onDestroy();
+}
+
+TEST_F(AdaptiveConcurrencyFilterTest, RouteSelectsUnknownController) {
+  setUpNamedController("unknown");
+
+  // An unknown controller name falls back to the default controller.
+  EXPECT_CALL(*named_controller_, forwardingDecision()).Times(0);
+  EXPECT_CALL(*controller_, forwardingDecision()).WillOnce(Return(RequestForwardingAction::Block));
+  EXPECT_CALL(decoder_callbacks_, sendLocalReply(Http::Code::ServiceUnavailable, _, _, _, _));
+  Http::TestRequestHeaderMapImpl request_headers;
+  EXPECT_EQ(Http::FilterHeadersStatus::StopIteration,
+            filter_->decodeHeaders(request_headers, true));
+}
+
 } // namespace
 } // namespace AdaptiveConcurrency
 } // namespace HttpFilters
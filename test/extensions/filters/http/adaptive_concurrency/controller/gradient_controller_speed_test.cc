@@ -0,0 +1,85 @@
+// Note: this should be run with --compilation_mode=opt, and would benefit from a
+// quiescent system with disabled cstate power management.
+
+#include <chrono>
+#include <memory>
+
+#include "envoy/extensions/filters/http/adaptive_concurrency/v3/adaptive_concurrency.pb.h"
+
+#include "source/common/event/real_time_system.h"
+#include "source/common/stats/isolated_store_impl.h"
+#include "source/extensions/filters/http/adaptive_concurrency/controller/gradient_controller.h"
+
+#include "test/mocks/common.h"
+#include "test/mocks/event/mocks.h"
+#include "test/mocks/runtime/mocks.h"
+#include "test/test_common/utility.h"
+
+#include "benchmark/benchmark.h"
+
+using testing::NiceMock;
+
+namespace Envoy {
+namespace Extensions {
+namespace HttpFilters {
+namespace AdaptiveConcurrency {
+namespace Controller {
+
+// State shared by all of the benchmark threads, which stand in for the worker threads.
+struct ControllerContext {
+  ControllerContext() {
+    envoy::extensions::filters::http::adaptive_concurrency::v3::GradientControllerConfig proto;
+    TestUtility::loadFromYaml(R"EOF(
+concurrency_limit_params:
+  concurrency_update_interval: 0.1s
+min_rtt_calc_params:
+  interval: 3600s
+  request_count: 50
+  min_concurrency: 100
+)EOF",
+                              proto);
+    controller_ = std::make_unique<GradientController>(GradientControllerConfig{proto, runtime_},
+                                                       dispatcher_, runtime_, "test_prefix.",
+                                                       store_, random_, time_system_);
+  }
+
+  Event::RealTimeSystem time_system_;
+  Stats::IsolatedStoreImpl store_;
+  NiceMock<Runtime::MockLoader> runtime_;
+  NiceMock<Event::MockDispatcher> dispatcher_;
+  NiceMock<Random::MockRandomGenerator> random_;
+  std::unique_ptr<GradientController> controller_;
+};
+
+static ControllerContext* context;
+
+// Measures the overhead the controller adds to each request, from the forwarding decision to the
+// recorded latency sample, when all of the workers share one controller. The timers are mocked, so
+// the sample windows are not reset while the benchmark runs.
+static void BM_ForwardAndRecordLatency(benchmark::State& state) {
+  if (state.thread_index == 0) {
+    context = new ControllerContext();
+  }
+
+  // The context is only guaranteed to be set up once all threads enter the benchmark loop.
+  for (auto _ : state) {
+    UNREFERENCED_PARAMETER(_);
+    GradientController& controller = *context->controller_;
+    const MonotonicTime rq_send_time = context->time_system_.monotonicTime();
+    if (controller.forwardingDecision() == RequestForwardingAction::Forward) {
+      controller.recordLatencySample(rq_send_time);
+    }
+  }
+
+  if (state.thread_index == 0) {
+    delete context;
+    context = nullptr;
+  }
+}
+BENCHMARK(BM_ForwardAndRecordLatency)->ThreadRange(1, 64)->UseRealTime();
+
+} // namespace Controller
+} // namespace AdaptiveConcurrency
+} // namespace HttpFilters
+} // namespace Extensions
+} // namespace Envoy
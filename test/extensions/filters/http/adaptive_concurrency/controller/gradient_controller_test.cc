@@ -844,6 +844,57 @@ min_rtt_calc_params:
   EXPECT_FALSE(controller->inMinRTTSamplingWindow());
 }
 
+// Verify that latency samples recorded on different threads are aggregated.
+TEST_F(GradientControllerTest, MultiThreadSamplesAggregated) {
+  const std::string yaml = R"EOF(
+sample_aggregate_percentile:
+  value: 50
+concurrency_limit_params:
+  max_concurrency_limit:
+  concurrency_update_interval: 0.1s
+min_rtt_calc_params:
+  jitter:
+    value: 0.0
+  interval: 3600s
+  request_count: 40
+  buffer:
+    value: 0
+  min_concurrency: 100
+)EOF";
+
+  auto controller = makeController(yaml);
+  const auto latency = std::chrono::milliseconds(5);
+  const auto sample_from_threads = [this, &controller, latency]() {
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i) {
+      threads.emplace_back([this, &controller, latency]() {
+        for (int j = 0; j < 10; ++j) {
+          tryForward(controller, true);
+          sampleLatency(controller, latency);
+        }
+      });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  };
+
+  // The samples from all threads together complete the minRTT calculation.
+  EXPECT_TRUE(controller->inMinRTTSamplingWindow());
+  sample_from_threads();
+  EXPECT_FALSE(controller->inMinRTTSamplingWindow());
+  verifyMinRTTInactive();
+  verifyMinRTTValue(latency);
+  EXPECT_EQ(100, controller->concurrencyLimit());
+
+  // The samples from all threads are used when the sample window is reset. The sampled latency
+  // matches the minRTT, so the limit only grows by the burst headroom.
+  sample_from_threads();
+  time_system_.advanceTimeAndRun(std::chrono::milliseconds(101), *dispatcher_,
+                                 Event::Dispatcher::RunType::Block);
+  EXPECT_EQ(110, controller->concurrencyLimit());
+}
+
 } // namespace
 } // namespace Controller
 } // namespace AdaptiveConcurrency
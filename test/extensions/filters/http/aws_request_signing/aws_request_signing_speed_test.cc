@@ -0,0 +1,70 @@
+// Note: this should be run with --compilation_mode=opt, and would benefit from a
+// quiescent system with disabled cstate power management.
+
+#include <memory>
+#include <string>
+
+#include "source/common/buffer/buffer_impl.h"
+#include "source/common/event/real_time_system.h"
+#include "source/common/stats/isolated_store_impl.h"
+#include "source/extensions/common/aws/signer_impl.h"
+#include "source/extensions/filters/http/aws_request_signing/aws_request_signing_filter.h"
+
+#include "test/extensions/common/aws/mocks.h"
+#include "test/mocks/http/mocks.h"
+#include "test/test_common/utility.h"
+
+#include "benchmark/benchmark.h"
+
+using testing::NiceMock;
+using testing::Return;
+
+namespace Envoy {
+namespace Extensions {
+namespace HttpFilters {
+namespace AwsRequestSigningFilter {
+
+constexpr uint64_t ChunkSize = 16 * 1024;
+
+// Measures the cost of signing an upload whose payload is included in the signature, from the
+// request headers to the last chunk of the body. The state passed as the argument is the size of
+// the body, which is received in 16KiB chunks.
+static void BM_SignedUpload(benchmark::State& state) {
+  Event::RealTimeSystem time_system;
+  Stats::IsolatedStoreImpl stats_store;
+  auto credentials_provider = std::make_shared<NiceMock<Common::Aws::MockCredentialsProvider>>();
+  ON_CALL(*credentials_provider, getCredentials())
+      .WillByDefault(Return(Common::Aws::Credentials("akid", "secret")));
+  auto signer = std::make_unique<Common::Aws::SignerImpl>(
+      "s3", "us-west-2", credentials_provider, time_system,
+      Common::Aws::AwsSigV4HeaderExclusionVector{});
+  auto config = std::make_shared<FilterConfigImpl>(std::move(signer), "test.", stats_store, "",
+                                                   false);
+  NiceMock<Http::MockStreamDecoderFilterCallbacks> decoder_callbacks;
+
+  const uint64_t body_size = state.range(0);
+  const std::string chunk(ChunkSize, 'a');
+  for (auto _ : state) {
+    UNREFERENCED_PARAMETER(_);
+    Filter filter(config);
+    filter.setDecoderFilterCallbacks(decoder_callbacks);
+    Http::TestRequestHeaderMapImpl headers{
+        {":method", "PUT"}, {":path", "/bucket/key"}, {":authority", "s3.amazonaws.com"}};
+    filter.decodeHeaders(headers, false);
+    for (uint64_t received = 0; received < body_size; received += ChunkSize) {
+      Buffer::OwnedImpl data(chunk);
+      filter.decodeData(data, received + ChunkSize >= body_size);
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * body_size);
+}
+BENCHMARK(BM_SignedUpload)
+    ->Arg(ChunkSize)
+    ->Arg(1 << 20)
+    ->Arg(16 << 20)
+    ->Unit(benchmark::kMicrosecond);
+
+} // namespace AwsRequestSigningFilter
+} // namespace HttpFilters
+} // namespace Extensions
+} // namespace Envoy
@@ -0,0 +1,107 @@
+// Note: this should be run with --compilation_mode=opt, and would benefit from a
+// quiescent system with disabled cstate power management.
+
+#include <string>
+
+#include "source/common/buffer/buffer_impl.h"
+#include "source/common/common/base64.h"
+#include "source/common/grpc/codec.h"
+#include "source/common/grpc/context_impl.h"
+#include "source/common/http/headers.h"
+#include "source/common/stats/symbol_table_impl.h"
+#include "source/extensions/filters/http/grpc_web/grpc_web_filter.h"
+
+#include "test/mocks/http/mocks.h"
+#include "test/test_common/utility.h"
+
+#include "benchmark/benchmark.h"
+
+using testing::NiceMock;
+
+namespace Envoy {
+namespace Extensions {
+namespace HttpFilters {
+namespace GrpcWeb {
+
+constexpr uint64_t ChunkSize = 16 * 1024;
+
+Http::TestRequestHeaderMapImpl textRequestHeaders() {
+  return Http::TestRequestHeaderMapImpl{
+      {"content-type", Http::Headers::get().ContentTypeValues.GrpcWebText},
+      {"accept", Http::Headers::get().ContentTypeValues.GrpcWebText},
+      {":path", "/test.Service/Method"}};
+}
+
+// Measures the cost of decoding a base64 encoded application/grpc-web-text request body. The state
+// passed as the argument is the size of the encoded body, which is received in 16KiB chunks.
+static void BM_TextRequest(benchmark::State& state) {
+  Stats::SymbolTableImpl symbol_table;
+  Grpc::ContextImpl grpc_context(symbol_table);
+  NiceMock<Http::MockStreamDecoderFilterCallbacks> decoder_callbacks;
+  NiceMock<Http::MockStreamEncoderFilterCallbacks> encoder_callbacks;
+
+  const uint64_t body_size = state.range(0);
+  const std::string chunk = Base64::encode(std::string(ChunkSize / 4 * 3, 'a').data(),
+                                           ChunkSize / 4 * 3);
+  for (auto _ : state) {
+    UNREFERENCED_PARAMETER(_);
+    GrpcWebFilter filter(grpc_context);
+    filter.setDecoderFilterCallbacks(decoder_callbacks);
+    filter.setEncoderFilterCallbacks(encoder_callbacks);
+    auto headers = textRequestHeaders();
+    filter.decodeHeaders(headers, false);
+    for (uint64_t received = 0; received < body_size; received += chunk.size()) {
+      Buffer::OwnedImpl data(chunk);
+      filter.decodeData(data, received + chunk.size() >= body_size);
+    }
+    filter.onDestroy();
+  }
+  state.SetBytesProcessed(state.iterations() * body_size);
+}
+BENCHMARK(BM_TextRequest)
+    ->Arg(ChunkSize)
+    ->Arg(1 << 20)
+    ->Arg(16 << 20)
+    ->Unit(benchmark::kMicrosecond);
+
+// Measures the cost of encoding a gRPC response body as application/grpc-web-text. The state passed
+// as the argument is the size of the response body, which is received as a sequence of 16KiB gRPC
+// frames.
+static void BM_TextResponse(benchmark::State& state) {
+  Stats::SymbolTableImpl symbol_table;
+  Grpc::ContextImpl grpc_context(symbol_table);
+  NiceMock<Http::MockStreamDecoderFilterCallbacks> decoder_callbacks;
+  NiceMock<Http::MockStreamEncoderFilterCallbacks> encoder_callbacks;
+
+  const uint64_t body_size = state.range(0);
+  Buffer::OwnedImpl frame(std::string(ChunkSize - Grpc::GRPC_FRAME_HEADER_SIZE, 'a'));
+  Grpc::Encoder().prependFrameHeader(Grpc::GRPC_FH_DEFAULT, frame);
+  const std::string chunk = frame.toString();
+  for (auto _ : state) {
+    UNREFERENCED_PARAMETER(_);
+    GrpcWebFilter filter(grpc_context);
+    filter.setDecoderFilterCallbacks(decoder_callbacks);
+    filter.setEncoderFilterCallbacks(encoder_callbacks);
+    auto request_headers = textRequestHeaders();
+    filter.decodeHeaders(request_headers, true);
+    Http::TestResponseHeaderMapImpl response_headers{
+        {":status", "200"}, {"content-type", Http::Headers::get().ContentTypeValues.Grpc}};
+    filter.encodeHeaders(response_headers, false);
+    for (uint64_t sent = 0; sent < body_size; sent += ChunkSize) {
+      Buffer::OwnedImpl data(chunk);
+      filter.encodeData(data, false);
+    }
+    filter.onDestroy();
+  }
+  state.SetBytesProcessed(state.iterations() * body_size);
+}
+BENCHMARK(BM_TextResponse)
+    ->Arg(ChunkSize)
+    ->Arg(1 << 20)
+    ->Arg(16 << 20)
+    ->Unit(benchmark::kMicrosecond);
+
+} // namespace GrpcWeb
+} // namespace HttpFilters
+} // namespace Extensions
+} // namespace Envoy
@@ -308,6 +308,27 @@ TEST_F(GrpcWebFilterTest, Base64NoPadding) {
   EXPECT_EQ(decoder_callbacks_.details(), "grpc_base_64_decode_failed_bad_size");
 }
 
+// Each gRPC frame of a text response is base64 encoded on its own, including frames whose payload
+// spans several slices of the response data.
+TEST_F(GrpcWebFilterTest, TextResponseMultipleFrames) {
+  Http::TestRequestHeaderMapImpl request_headers{
+      {"content-type", Http::Headers::get().ContentTypeValues.GrpcWebText},
+      {"accept", Http::Headers::get().ContentTypeValues.GrpcWebText},
+      {":path", "/"}};
+  EXPECT_EQ(Http::FilterHeadersStatus::Continue, filter_.decodeHeaders(request_headers, false));
+
+  Http::TestResponseHeaderMapImpl response_headers{
+      {":status", "200"}, {"content-type", Http::Headers::get().ContentTypeValues.Grpc}};
+  EXPECT_EQ(Http::FilterHeadersStatus::Continue, filter_.encodeHeaders(response_headers, false));
+
+  Buffer::OwnedImpl response_buffer;
+  response_buffer.add(TEXT_MESSAGE, 8);
+  response_buffer.appendSliceForTest(TEXT_MESSAGE + 8, TEXT_MESSAGE_SIZE - 8);
+  response_buffer.add(TEXT_MESSAGE, TEXT_MESSAGE_SIZE);
+  EXPECT_EQ(Http::FilterDataStatus::Continue, filter_.encodeData(response_buffer, false));
+  EXPECT_EQ(absl::StrCat(B64_MESSAGE, B64_MESSAGE), response_buffer.toString());
+}
+
 TEST_F(GrpcWebFilterTest, InvalidUpstreamResponseForText) {
   Http::TestRequestHeaderMapImpl request_headers{
       {"content-type", Http::Headers::get().ContentTypeValues.GrpcWebText}, {":path", "/"}};
@@ -10,6 +10,7 @@
 
 #include "test/mocks/server/factory_context.h"
 #include "test/mocks/upstream/cluster_info.h"
+#include "test/mocks/upstream/cluster_priority_set.h"
 #include "test/test_common/printers.h"
 #include "test/test_common/test_runtime.h"
 #include "test/test_common/utility.h"
@@ -46,14 +47,16 @@ public:
 
   void prepareFilter(
       bool pass_through,
-      ClusterMinHealthyPercentagesConstSharedPtr cluster_min_healthy_percentages = nullptr) {
+      ClusterMinHealthyPercentagesConstSharedPtr cluster_min_healthy_percentages = nullptr,
+      ClusterHealthResponseCacheManagerSharedPtr cluster_health_cache = nullptr) {
     header_data_ = std::make_shared<std::vector<Http::HeaderUtility::HeaderDataPtr>>();
     envoy::config::route::v3::HeaderMatcher matcher;
     matcher.set_name(":path");
     matcher.mutable_string_match()->set_exact("/healthcheck");
     header_data_->emplace_back(std::make_unique<Http::HeaderUtility::HeaderData>(matcher));
     filter_ = std::make_unique<HealthCheckFilter>(context_, pass_through, cache_manager_,
-                                                  header_data_, cluster_min_healthy_percentages);
+                                                  header_data_, cluster_min_healthy_percentages,
+                                                  cluster_health_cache);
     filter_->setDecoderFilterCallbacks(callbacks_);
   }
 
@@ -228,6 +231,126 @@ TEST_F(HealthCheckFilterNoPassThroughTest, ComputedHealth) {
   }
 }
 
+// Verify that the computed health is cached per thread until one of the clusters changes.
+TEST_F(HealthCheckFilterNoPassThroughTest, CachedComputedHealth) {
+  auto cluster_min_healthy_percentages = ClusterMinHealthyPercentagesConstSharedPtr(
+      new ClusterMinHealthyPercentages{{"www1", 50.0}, {"www2", 75.0}});
+  MockHealthCheckCluster cluster_www1(100, 50);
+  MockHealthCheckCluster cluster_www2(1000, 800);
+  ON_CALL(context_.cluster_manager_, getThreadLocalCluster(Eq("www1")))
+      .WillByDefault(Return(&cluster_www1));
+  ON_CALL(context_.cluster_manager_, getThreadLocalCluster(Eq("www2")))
+      .WillByDefault(Return(&cluster_www2));
+  NiceMock<Upstream::MockClusterMockPrioritySet> main_cluster_www1;
+  NiceMock<Upstream::MockClusterMockPrioritySet> main_cluster_www2;
+  Upstream::ClusterManager::ClusterInfoMaps cluster_maps;
+  cluster_maps.active_clusters_.emplace("www1", main_cluster_www1);
+  cluster_maps.active_clusters_.emplace("www2", main_cluster_www2);
+  ON_CALL(context_.cluster_manager_, clusters()).WillByDefault(Return(cluster_maps));
+  // The cluster update callbacks of the thread local cache and of the cache manager.
+  std::vector<Upstream::ClusterUpdateCallbacks*> cluster_update_callbacks;
+  EXPECT_CALL(context_.cluster_manager_, addThreadLocalClusterUpdateCallbacks_(_))
+      .Times(2)
+      .WillRepeatedly(Invoke([&](Upstream::ClusterUpdateCallbacks& callbacks) {
+        cluster_update_callbacks.push_back(&callbacks);
+        return nullptr;
+      }));
+
+  prepareFilter(false, cluster_min_healthy_percentages,
+                std::make_shared<ClusterHealthResponseCacheManager>(
+                    context_.thread_local_, context_.cluster_manager_,
+                    cluster_min_healthy_percentages));
+  ON_CALL(context_, healthCheckFailed()).WillByDefault(Return(false));
+
+  const auto expect_response = [this](const std::string& status, const std::string& details) {
+    Http::TestResponseHeaderMapImpl health_check_response{{":status", status}};
+    EXPECT_CALL(callbacks_, encodeHeaders_(HeaderMapEqualRef(&health_check_response), true));
+    EXPECT_EQ(Http::FilterHeadersStatus::StopIteration,
+              filter_->decodeHeaders(request_headers_, true));
+    EXPECT_EQ(details, callbacks_.details());
+  };
+
+  // The first health check computes the response.
+  expect_response("200", "health_check_ok_cluster_healthy");
+
+  // Later health checks use the cached response and do not look up the clusters.
+  EXPECT_CALL(context_.cluster_manager_, getThreadLocalCluster(_)).Times(0);
+  cluster_www1.info()->stats().membership_healthy_.set(49);
+  expect_response("200", "health_check_ok_cluster_healthy");
+  testing::Mock::VerifyAndClearExpectations(&context_.cluster_manager_);
+
+  // A host or health change in one of the clusters refreshes the response.
+  main_cluster_www1.priority_set_.runUpdateCallbacks(0, {}, {});
+  expect_response("503", "health_check_failed_cluster_unhealthy");
+
+  cluster_www1.info()->stats().membership_healthy_.set(50);
+  main_cluster_www1.priority_set_.runUpdateCallbacks(0, {}, {});
+  expect_response("200", "health_check_ok_cluster_healthy");
+
+  // Removing one of the clusters refreshes the response.
+  ON_CALL(context_.cluster_manager_, getThreadLocalCluster(Eq("www2")))
+      .WillByDefault(Return(nullptr));
+  ASSERT_EQ(2UL, cluster_update_callbacks.size());
+  for (Upstream::ClusterUpdateCallbacks* callbacks : cluster_update_callbacks) {
+    callbacks->onClusterRemoval("www2");
+  }
+  expect_response("503", "health_check_failed_no_cluster_found");
+
+  // Adding it back refreshes the response.
+  ON_CALL(context_.cluster_manager_, getThreadLocalCluster(Eq("www2")))
+      .WillByDefault(Return(&cluster_www2));
+  cluster_www2.cluster_.info_->name_ = "www2";
+  for (Upstream::ClusterUpdateCallbacks* callbacks : cluster_update_callbacks) {
+    callbacks->onClusterAddOrUpdate(cluster_www2);
+  }
+  expect_response("200", "health_check_ok_cluster_healthy");
+
+  // The cluster that was added back is watched again.
+  cluster_www2.info()->stats().membership_healthy_.set(749);
+  main_cluster_www2.priority_set_.runUpdateCallbacks(0, {}, {});
+  expect_response("503", "health_check_failed_cluster_unhealthy");
+}
+
+// Verify that the cached health is refreshed as soon as the cluster changes on the main thread.
+// With an update_merge_window, the thread local clusters are only updated once the window expires.
+TEST_F(HealthCheckFilterNoPassThroughTest, CachedComputedHealthWithUpdateMergeWindow) {
+  auto cluster_min_healthy_percentages = ClusterMinHealthyPercentagesConstSharedPtr(
+      new ClusterMinHealthyPercentages{{"www1", 50.0}});
+  MockHealthCheckCluster cluster_www1(100, 50);
+  ON_CALL(context_.cluster_manager_, getThreadLocalCluster(Eq("www1")))
+      .WillByDefault(Return(&cluster_www1));
+  NiceMock<Upstream::MockClusterMockPrioritySet> main_cluster_www1;
+  Upstream::ClusterManager::ClusterInfoMaps cluster_maps;
+  cluster_maps.active_clusters_.emplace("www1", main_cluster_www1);
+  ON_CALL(context_.cluster_manager_, clusters()).WillByDefault(Return(cluster_maps));
+
+  prepareFilter(false, cluster_min_healthy_percentages,
+                std::make_shared<ClusterHealthResponseCacheManager>(
+                    context_.thread_local_, context_.cluster_manager_,
+                    cluster_min_healthy_percentages));
+  ON_CALL(context_, healthCheckFailed()).WillByDefault(Return(false));
+
+  const auto expect_response = [this](const std::string& status, const std::string& details) {
+    Http::TestResponseHeaderMapImpl health_check_response{{":status", status}};
+    EXPECT_CALL(callbacks_, encodeHeaders_(HeaderMapEqualRef(&health_check_response), true));
+    EXPECT_EQ(Http::FilterHeadersStatus::StopIteration,
+              filter_->decodeHeaders(request_headers_, true));
+    EXPECT_EQ(details, callbacks_.details());
+  };
+
+  expect_response("200", "health_check_ok_cluster_healthy");
+
+  // The membership stats are updated on the main thread while the thread local cluster is still
+  // waiting for the merge window to expire.
+  cluster_www1.info()->stats().membership_healthy_.set(49);
+  main_cluster_www1.priority_set_.runUpdateCallbacks(0, {}, {});
+  expect_response("503", "health_check_failed_cluster_unhealthy");
+
+  // The thread local cluster being updated later does not change the response.
+  cluster_www1.cluster_.priority_set_.runUpdateCallbacks(0, {}, {});
+  expect_response("503", "health_check_failed_cluster_unhealthy");
+}
+
 TEST_F(HealthCheckFilterNoPassThroughTest, HealthCheckFailedCallbackCalled) {
   EXPECT_CALL(context_, healthCheckFailed()).Times(2).WillRepeatedly(Return(true));
   EXPECT_CALL(callbacks_.stream_info_, healthCheck(true));
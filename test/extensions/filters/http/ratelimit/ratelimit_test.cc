@@ -174,6 +174,36 @@ TEST_F(HttpRateLimitFilterTest, NoDescriptor) {
   EXPECT_EQ(Http::FilterTrailersStatus::Continue, filter_->encodeTrailers(response_trailers_));
 }
 
+// Test that a filter built from a client factory only creates its client once it calls the rate
+// limit service.
+TEST_F(HttpRateLimitFilterTest, LazyClientCreation) {
+  SetUpTest(filter_config_);
+  uint32_t clients_created = 0;
+  auto client_factory = std::make_shared<const Filter::ClientFactory>([&]() {
+    clients_created++;
+    client_ = new Filters::Common::RateLimit::MockClient();
+    EXPECT_CALL(*client_, limit(_, "foo", _, _, _));
+    return Filters::Common::RateLimit::ClientPtr{client_};
+  });
+
+  // No descriptors, so no client is needed.
+  filter_ = std::make_unique<Filter>(config_, client_factory);
+  filter_->setDecoderFilterCallbacks(filter_callbacks_);
+  EXPECT_CALL(route_rate_limit_, populateDescriptors(_, _, _, _));
+  EXPECT_CALL(vh_rate_limit_, populateDescriptors(_, _, _, _));
+  EXPECT_EQ(Http::FilterHeadersStatus::Continue, filter_->decodeHeaders(request_headers_, false));
+  EXPECT_EQ(0, clients_created);
+
+  filter_ = std::make_unique<Filter>(config_, client_factory);
+  filter_->setDecoderFilterCallbacks(filter_callbacks_);
+  EXPECT_CALL(route_rate_limit_, populateDescriptors(_, _, _, _))
+      .WillOnce(SetArgReferee<0>(descriptor_));
+  EXPECT_CALL(vh_rate_limit_, populateDescriptors(_, _, _, _));
+  EXPECT_EQ(Http::FilterHeadersStatus::StopIteration,
+            filter_->decodeHeaders(request_headers_, false));
+  EXPECT_EQ(1, clients_created);
+}
+
 TEST_F(HttpRateLimitFilterTest, RuntimeDisabled) {
   SetUpTest(filter_config_);
 
@@ -0,0 +1,94 @@
+#include <string>
+
+#include "source/common/api/os_sys_calls_impl.h"
+#include "source/common/http/utility.h"
+#include "source/common/network/io_socket_handle_impl.h"
+#include "source/common/network/listen_socket_impl.h"
+#include "source/common/network/listener_filter_buffer_impl.h"
+#include "source/extensions/filters/listener/http_inspector/http_inspector.h"
+#include "source/extensions/filters/listener/tls_inspector/tls_inspector.h"
+
+#include "test/mocks/api/mocks.h"
+#include "test/mocks/network/mocks.h"
+#include "test/mocks/stats/mocks.h"
+#include "test/test_common/threadsafe_singleton_injector.h"
+
+#include "benchmark/benchmark.h"
+
+using testing::NiceMock;
+
+namespace Envoy {
+namespace Extensions {
+namespace ListenerFilters {
+namespace HttpInspector {
+
+class FastMockListenerFilterCallbacks : public Network::MockListenerFilterCallbacks {
+public:
+  FastMockListenerFilterCallbacks(Network::ConnectionSocket& socket, Event::Dispatcher& dispatcher)
+      : socket_(socket), dispatcher_(dispatcher) {}
+  Network::ConnectionSocket& socket() override { return socket_; }
+  Event::Dispatcher& dispatcher() override { return dispatcher_; }
+  void continueFilterChain(bool success) override { RELEASE_ASSERT(success, ""); }
+  Network::ListenerFilterBuffer& listenerFilterBuffer() override { return *buffer_; }
+
+  Network::ConnectionSocket& socket_;
+  Event::Dispatcher& dispatcher_;
+  // Replaced for every accepted connection.
+  std::unique_ptr<Network::ListenerFilterBufferImpl> buffer_;
+};
+
+// Always returns the whole request, so no listener filter needs to wait for more data.
+class FastMockOsSysCalls : public Api::MockOsSysCalls {
+public:
+  FastMockOsSysCalls(absl::string_view request) : request_(request) {}
+
+  Api::SysCallSizeResult recv(os_fd_t, void* buffer, size_t length, int) override {
+    RELEASE_ASSERT(length >= request_.size(), "");
+    memcpy(buffer, request_.data(), request_.size());
+    ++recv_calls_;
+    return Api::SysCallSizeResult{ssize_t(request_.size()), 0};
+  }
+
+  const std::string request_;
+  uint64_t recv_calls_{};
+};
+
+constexpr absl::string_view Request = "GET /index HTTP/1.1\r\nhost: example.com\r\n\r\n";
+
+// Measures the accept path of a plaintext HTTP/1.1 connection through a listener that runs the
+// TLS inspector before the HTTP inspector, as is done to serve TLS and plaintext traffic on the
+// same port. The recv_per_accept counter reports the number of peeks at the socket.
+static void BM_TlsAndHttpInspector(benchmark::State& state) {
+  NiceMock<FastMockOsSysCalls> os_sys_calls(Request);
+  TestThreadsafeSingletonInjector<Api::OsSysCallsImpl> os_calls{&os_sys_calls};
+  NiceMock<Stats::MockStore> store;
+  envoy::extensions::filters::listener::tls_inspector::v3::TlsInspector proto_config;
+  auto tls_config = std::make_shared<TlsInspector::Config>(store, proto_config);
+  auto http_config = std::make_shared<Config>(store);
+  Network::IoHandlePtr io_handle = std::make_unique<Network::IoSocketHandleImpl>();
+  Network::ConnectionSocketImpl socket(std::move(io_handle), nullptr, nullptr);
+  NiceMock<Event::MockDispatcher> dispatcher;
+  FastMockListenerFilterCallbacks cb(socket, dispatcher);
+
+  for (auto _ : state) {
+    UNREFERENCED_PARAMETER(_);
+    cb.buffer_ = std::make_unique<Network::ListenerFilterBufferImpl>(socket.ioHandle());
+    TlsInspector::Filter tls_inspector(tls_config);
+    RELEASE_ASSERT(tls_inspector.onAccept(cb) == Network::FilterStatus::Continue, "");
+    Filter http_inspector(http_config);
+    RELEASE_ASSERT(http_inspector.onAccept(cb) == Network::FilterStatus::Continue, "");
+    RELEASE_ASSERT(socket.requestedApplicationProtocols().size() == 1 &&
+                       socket.requestedApplicationProtocols().front() ==
+                           Http::Utility::AlpnNames::get().Http11,
+                   "");
+    socket.setRequestedApplicationProtocols({});
+  }
+  state.counters["recv_per_accept"] =
+      benchmark::Counter(os_sys_calls.recv_calls_, benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_TlsAndHttpInspector)->Unit(benchmark::kMicrosecond);
+
+} // namespace HttpInspector
+} // namespace ListenerFilters
+} // namespace Extensions
+} // namespace Envoy
@@ -293,6 +293,25 @@ TEST_F(IoHandleImplTest, ReadvMultiSlices) {
   EXPECT_EQ(1024, result.return_value_);
 }
 
+// Test readv when the pending data ends in the middle of the provided slices.
+TEST_F(IoHandleImplTest, ReadvPartialMultiSlices) {
+  Buffer::OwnedImpl buf_to_write(std::string(512, 'a') + std::string(100, 'b'));
+  io_handle_peer_->write(buf_to_write);
+
+  char full_frag[1536];
+  Buffer::RawSlice slices[3] = {{full_frag, 512}, {full_frag + 512, 512}, {full_frag + 1024, 512}};
+
+  auto result = io_handle_->readv(1536, slices, 3);
+
+  EXPECT_TRUE(result.ok());
+  EXPECT_EQ(612, result.return_value_);
+  EXPECT_EQ(absl::string_view(full_frag, 612), std::string(512, 'a') + std::string(100, 'b'));
+
+  result = io_handle_->readv(1536, slices, 3);
+  EXPECT_FALSE(result.ok());
+  EXPECT_EQ(Api::IoError::IoErrorCode::Again, result.err_->getErrorCode());
+}
+
 TEST_F(IoHandleImplTest, FlowControl) {
   io_handle_->setWatermarks(128);
   EXPECT_FALSE(io_handle_->isReadable());
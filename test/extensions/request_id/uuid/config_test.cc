@@ -94,6 +94,12 @@ TEST(UUIDRequestIDExtensionTest, ModRequestIDBy) {
   request_headers.setRequestId("");
   EXPECT_FALSE(uuid_utils.toInteger(request_headers).has_value());
 
+  request_headers.setRequestId("0x00000f-0000-0000-0000-000000000000");
+  EXPECT_FALSE(uuid_utils.toInteger(request_headers).has_value());
+
+  request_headers.setRequestId("000000FF-0000-0000-0000-000000000000");
+  EXPECT_EQ(255, uuid_utils.toInteger(request_headers).value());
+
   request_headers.setRequestId("000000ff-0000-0000-0000-000000000000");
   EXPECT_EQ(55, uuid_utils.toInteger(request_headers).value() % 100);
 
@@ -0,0 +1,57 @@
+// Note: this should be run with --compilation_mode=opt, and would benefit from a
+// quiescent system with disabled cstate power management.
+
+#include "source/common/common/random_generator.h"
+#include "source/extensions/request_id/uuid/config.h"
+
+#include "test/test_common/utility.h"
+
+#include "benchmark/benchmark.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace RequestId {
+
+static void BM_UUIDRequestIDSet(benchmark::State& state) {
+  Random::RandomGeneratorImpl random;
+  UUIDRequestIDExtension uuid_utils(envoy::extensions::request_id::uuid::v3::UuidRequestIdConfig(),
+                                    random);
+  Http::TestRequestHeaderMapImpl request_headers;
+  for (auto _ : state) {
+    uuid_utils.set(request_headers, true);
+  }
+  benchmark::DoNotOptimize(request_headers.getRequestIdValue());
+}
+BENCHMARK(BM_UUIDRequestIDSet);
+
+static void BM_UUIDRequestIDToInteger(benchmark::State& state) {
+  Random::RandomGeneratorImpl random;
+  UUIDRequestIDExtension uuid_utils(envoy::extensions::request_id::uuid::v3::UuidRequestIdConfig(),
+                                    random);
+  Http::TestRequestHeaderMapImpl request_headers;
+  uuid_utils.set(request_headers, true);
+  uint64_t sum = 0;
+  for (auto _ : state) {
+    sum += uuid_utils.toInteger(request_headers).value();
+  }
+  benchmark::DoNotOptimize(sum);
+}
+BENCHMARK(BM_UUIDRequestIDToInteger);
+
+// Simulates a request that already carries the packed trace reason from a previous hop.
+static void BM_UUIDRequestIDSetTraceReason(benchmark::State& state) {
+  Random::RandomGeneratorImpl random;
+  UUIDRequestIDExtension uuid_utils(envoy::extensions::request_id::uuid::v3::UuidRequestIdConfig(),
+                                    random);
+  Http::TestRequestHeaderMapImpl request_headers;
+  uuid_utils.set(request_headers, true);
+  for (auto _ : state) {
+    uuid_utils.setTraceReason(request_headers, Tracing::Reason::Sampling);
+  }
+  benchmark::DoNotOptimize(uuid_utils.getTraceReason(request_headers));
+}
+BENCHMARK(BM_UUIDRequestIDSetTraceReason);
+
+} // namespace RequestId
+} // namespace Extensions
+} // namespace Envoy
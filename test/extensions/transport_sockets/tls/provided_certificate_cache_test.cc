@@ -0,0 +1,161 @@
+#include <memory>
+
+#include "source/extensions/transport_sockets/tls/provided_certificate_cache.h"
+
+#include "test/test_common/simulated_time_system.h"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+using testing::_;
+using testing::Eq;
+using testing::Optional;
+
+namespace Envoy {
+namespace Extensions {
+namespace TransportSockets {
+namespace Tls {
+namespace {
+
+Ssl::ProvidedCertificateConstSharedPtr makeCertificate() {
+  return std::make_shared<Ssl::ProvidedCertificate>();
+}
+
+class MockWaiter : public ProvidedCertificateCache::Waiter {
+public:
+  MOCK_METHOD(void, onFetchDone,
+              (absl::optional<Ssl::ProvidedCertificateConstSharedPtr> certificate));
+};
+
+class ProvidedCertificateCacheTest : public testing::Test {
+public:
+  // Looks up the server name, expecting it to be cached.
+  Ssl::ProvidedCertificateConstSharedPtr lookupCached(ProvidedCertificateCache& cache,
+                                                      absl::string_view server_name) {
+    Ssl::ProvidedCertificateConstSharedPtr certificate;
+    EXPECT_EQ(ProvidedCertificateCache::LookupStatus::Hit,
+              cache.lookup(server_name, waiter_, certificate));
+    return certificate;
+  }
+
+  // Fetches the certificate for the server name after a miss.
+  void fetch(ProvidedCertificateCache& cache, absl::string_view server_name,
+             Ssl::ProvidedCertificateConstSharedPtr certificate) {
+    Ssl::ProvidedCertificateConstSharedPtr cached;
+    EXPECT_EQ(ProvidedCertificateCache::LookupStatus::Miss,
+              cache.lookup(server_name, waiter_, cached));
+    cache.fetchDone(server_name, certificate);
+  }
+
+  Event::SimulatedTimeSystem time_system_;
+  MockWaiter waiter_;
+};
+
+TEST_F(ProvidedCertificateCacheTest, Lookup) {
+  ProvidedCertificateCache cache(2, std::chrono::seconds(30), time_system_);
+  auto a = makeCertificate();
+  fetch(cache, "a.example.com", a);
+  EXPECT_EQ(a, lookupCached(cache, "a.example.com"));
+
+  // Certificates do not expire.
+  time_system_.advanceTimeWait(std::chrono::seconds(60));
+  EXPECT_EQ(a, lookupCached(cache, "a.example.com"));
+  EXPECT_EQ(1, cache.size());
+}
+
+TEST_F(ProvidedCertificateCacheTest, EvictsLeastRecentlyUsed) {
+  ProvidedCertificateCache cache(2, std::chrono::seconds(30), time_system_);
+  auto a = makeCertificate();
+  auto b = makeCertificate();
+  auto c = makeCertificate();
+  fetch(cache, "a.example.com", a);
+  fetch(cache, "b.example.com", b);
+
+  // Looking up a makes b the least recently used entry.
+  EXPECT_EQ(a, lookupCached(cache, "a.example.com"));
+  fetch(cache, "c.example.com", c);
+  EXPECT_EQ(2, cache.size());
+  fetch(cache, "b.example.com", b);
+  EXPECT_EQ(2, cache.size());
+  EXPECT_EQ(b, lookupCached(cache, "b.example.com"));
+  EXPECT_EQ(c, lookupCached(cache, "c.example.com"));
+}
+
+TEST_F(ProvidedCertificateCacheTest, ZeroCapacity) {
+  ProvidedCertificateCache cache(0, std::chrono::seconds(30), time_system_);
+  fetch(cache, "a.example.com", makeCertificate());
+  EXPECT_EQ(0, cache.size());
+  fetch(cache, "a.example.com", makeCertificate());
+}
+
+// Server names without a certificate are cached until the negative TTL expires.
+TEST_F(ProvidedCertificateCacheTest, NegativeTtl) {
+  ProvidedCertificateCache cache(2, std::chrono::seconds(30), time_system_);
+  fetch(cache, "a.example.com", nullptr);
+  EXPECT_EQ(nullptr, lookupCached(cache, "a.example.com"));
+
+  time_system_.advanceTimeWait(std::chrono::seconds(29));
+  EXPECT_EQ(nullptr, lookupCached(cache, "a.example.com"));
+
+  time_system_.advanceTimeWait(std::chrono::seconds(1));
+  fetch(cache, "a.example.com", nullptr);
+  EXPECT_EQ(1, cache.size());
+
+  // A zero TTL does not cache the absence of a certificate.
+  ProvidedCertificateCache uncached(2, std::chrono::seconds(0), time_system_);
+  fetch(uncached, "a.example.com", nullptr);
+  EXPECT_EQ(0, uncached.size());
+}
+
+// Lookups of a server name that is being fetched wait for the fetch.
+TEST_F(ProvidedCertificateCacheTest, CoalescesFetches) {
+  ProvidedCertificateCache cache(2, std::chrono::seconds(30), time_system_);
+  Ssl::ProvidedCertificateConstSharedPtr certificate;
+  EXPECT_EQ(ProvidedCertificateCache::LookupStatus::Miss,
+            cache.lookup("a.example.com", waiter_, certificate));
+
+  MockWaiter waiter1;
+  MockWaiter waiter2;
+  MockWaiter removed_waiter;
+  EXPECT_EQ(ProvidedCertificateCache::LookupStatus::Waiting,
+            cache.lookup("a.example.com", waiter1, certificate));
+  EXPECT_EQ(ProvidedCertificateCache::LookupStatus::Waiting,
+            cache.lookup("a.example.com", waiter2, certificate));
+  EXPECT_EQ(ProvidedCertificateCache::LookupStatus::Waiting,
+            cache.lookup("a.example.com", removed_waiter, certificate));
+  cache.removeWaiter("a.example.com", removed_waiter);
+
+  // Other server names are fetched separately.
+  EXPECT_EQ(ProvidedCertificateCache::LookupStatus::Miss,
+            cache.lookup("b.example.com", waiter1, certificate));
+
+  auto a = makeCertificate();
+  EXPECT_CALL(waiter1, onFetchDone(Optional(Eq(a))));
+  EXPECT_CALL(waiter2, onFetchDone(Optional(Eq(a))));
+  EXPECT_CALL(removed_waiter, onFetchDone(_)).Times(0);
+  cache.fetchDone("a.example.com", a);
+  EXPECT_EQ(a, lookupCached(cache, "a.example.com"));
+}
+
+// The waiters look the server name up again when the fetch they wait for is cancelled.
+TEST_F(ProvidedCertificateCacheTest, CancelledFetch) {
+  ProvidedCertificateCache cache(2, std::chrono::seconds(30), time_system_);
+  Ssl::ProvidedCertificateConstSharedPtr certificate;
+  EXPECT_EQ(ProvidedCertificateCache::LookupStatus::Miss,
+            cache.lookup("a.example.com", waiter_, certificate));
+  MockWaiter waiter;
+  EXPECT_EQ(ProvidedCertificateCache::LookupStatus::Waiting,
+            cache.lookup("a.example.com", waiter, certificate));
+
+  EXPECT_CALL(waiter, onFetchDone(Eq(absl::nullopt)));
+  cache.fetchDone("a.example.com", absl::nullopt);
+  EXPECT_EQ(0, cache.size());
+  EXPECT_EQ(ProvidedCertificateCache::LookupStatus::Miss,
+            cache.lookup("a.example.com", waiter, certificate));
+}
+
+} // namespace
+} // namespace Tls
+} // namespace TransportSockets
+} // namespace Extensions
+} // namespace Envoy
@@ -32,6 +32,7 @@
 #include "test/extensions/transport_sockets/tls/test_data/san_dns_cert_info.h"
 #include "test/extensions/transport_sockets/tls/test_data/san_uri_cert_info.h"
 #include "test/extensions/transport_sockets/tls/test_data/selfsigned_ecdsa_p256_cert_info.h"
+#include "test/extensions/transport_sockets/tls/test_data/unittest_cert_info.h"
 #include "test/extensions/transport_sockets/tls/test_private_key_method_provider.h"
 #include "test/mocks/buffer/mocks.h"
 #include "test/mocks/init/mocks.h"
@@ -48,10 +49,12 @@
 #include "test/test_common/test_runtime.h"
 #include "test/test_common/utility.h"
 
+#include "absl/container/flat_hash_map.h"
 #include "absl/strings/str_replace.h"
 #include "absl/types/optional.h"
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
+#include "openssl/pem.h"
 #include "openssl/ssl.h"
 
 using testing::_;
@@ -2944,6 +2947,146 @@ TEST_P(SslSocketTest, ClientAuthMultipleCAs) {
   EXPECT_EQ(1UL, server_stats_store.counter("ssl.handshake").value());
 }
 
+// Serves the certificates of a fixed set of server names, completing each fetch on a later
+// iteration of the connection's event loop.
+class TestCertificateProvider : public Ssl::CertificateProvider {
+public:
+  struct Fetch : public Ssl::CertificateFetch {
+    void cancel() override { cancelled_ = true; }
+    bool cancelled_{};
+  };
+
+  // Ssl::CertificateProvider
+  Ssl::CertificateFetch* fetchCertificate(absl::string_view server_name,
+                                          Event::Dispatcher& dispatcher,
+                                          Ssl::CertificateProviderCallbacks& callbacks) override {
+    fetched_server_names_.emplace_back(server_name);
+    auto it = certificates_.find(server_name);
+    Ssl::ProvidedCertificateConstSharedPtr certificate =
+        it != certificates_.end() ? it->second : nullptr;
+    Fetch* fetch = fetches_.emplace_back(std::make_unique<Fetch>()).get();
+    dispatcher.post([fetch, &callbacks, certificate]() {
+      if (!fetch->cancelled_) {
+        callbacks.onCertificateFetchComplete(certificate);
+      }
+    });
+    return fetch;
+  }
+
+  void addCertificate(const std::string& server_name, const std::string& cert_path,
+                      const std::string& key_path) {
+    auto certificate = std::make_shared<Ssl::ProvidedCertificate>();
+    const std::string cert_pem =
+        TestEnvironment::readFileToStringForTest(TestEnvironment::substitute(cert_path));
+    bssl::UniquePtr<BIO> cert_bio(BIO_new_mem_buf(cert_pem.data(), cert_pem.size()));
+    certificate->cert_chain_.reset(PEM_read_bio_X509(cert_bio.get(), nullptr, nullptr, nullptr));
+    const std::string key_pem =
+        TestEnvironment::readFileToStringForTest(TestEnvironment::substitute(key_path));
+    bssl::UniquePtr<BIO> key_bio(BIO_new_mem_buf(key_pem.data(), key_pem.size()));
+    certificate->private_key_.reset(
+        PEM_read_bio_PrivateKey(key_bio.get(), nullptr, nullptr, nullptr));
+    certificates_[server_name] = std::move(certificate);
+  }
+
+  std::vector<std::string> fetched_server_names_;
+
+private:
+  absl::flat_hash_map<std::string, Ssl::ProvidedCertificateConstSharedPtr> certificates_;
+  std::vector<std::unique_ptr<Fetch>> fetches_;
+};
+
+// Test that the handshake is suspended while the certificate for the SNI is fetched from the
+// certificate provider, and that fetched certificates are served from the cache afterwards.
+TEST_P(SslSocketTest, AsyncCertificateProvider) {
+  const std::string server_ctx_yaml = R"EOF(
+  common_tls_context:
+    tls_certificates:
+      certificate_chain:
+        filename: "{{ test_rundir }}/test/extensions/transport_sockets/tls/test_data/unittest_cert.pem"
+      private_key:
+        filename: "{{ test_rundir }}/test/extensions/transport_sockets/tls/test_data/unittest_key.pem"
+)EOF";
+
+  auto provider = std::make_shared<TestCertificateProvider>();
+  provider->addCertificate(
+      "server1.example.com",
+      "{{ test_rundir }}/test/extensions/transport_sockets/tls/test_data/san_dns_cert.pem",
+      "{{ test_rundir }}/test/extensions/transport_sockets/tls/test_data/san_dns_key.pem");
+
+  envoy::extensions::transport_sockets::tls::v3::DownstreamTlsContext server_tls_context;
+  TestUtility::loadFromYaml(TestEnvironment::substitute(server_ctx_yaml), server_tls_context);
+  auto server_cfg = std::make_unique<ServerContextConfigImpl>(server_tls_context, factory_context_);
+  server_cfg->setCertificateProvider(provider);
+  ContextManagerImpl manager(time_system_);
+  Stats::TestUtil::TestStore server_stats_store;
+  ServerSslSocketFactory server_ssl_socket_factory(std::move(server_cfg), manager,
+                                                   server_stats_store, std::vector<std::string>{});
+
+  auto socket = std::make_shared<Network::Test::TcpListenSocketImmediateListen>(
+      Network::Test::getCanonicalLoopbackAddress(GetParam()));
+  Network::MockTcpListenerCallbacks callbacks;
+  Network::ListenerPtr listener = dispatcher_->createListener(socket, callbacks, true, false);
+
+  // Returns the digest of the certificate the server presents for the SNI.
+  auto connect = [&](const std::string& sni) -> std::string {
+    envoy::extensions::transport_sockets::tls::v3::UpstreamTlsContext tls_context;
+    tls_context.set_sni(sni);
+    auto client_cfg = std::make_unique<ClientContextConfigImpl>(tls_context, factory_context_);
+    Stats::TestUtil::TestStore client_stats_store;
+    ClientSslSocketFactory ssl_socket_factory(std::move(client_cfg), manager, client_stats_store);
+    Network::ClientConnectionPtr client_connection = dispatcher_->createClientConnection(
+        socket->connectionInfoProvider().localAddress(), Network::Address::InstanceConstSharedPtr(),
+        ssl_socket_factory.createTransportSocket(nullptr), nullptr);
+    client_connection->connect();
+
+    Network::ConnectionPtr server_connection;
+    Network::MockConnectionCallbacks server_connection_callbacks;
+    EXPECT_CALL(callbacks, onAccept_(_))
+        .WillOnce(Invoke([&](Network::ConnectionSocketPtr& socket) -> void {
+          server_connection = dispatcher_->createServerConnection(
+              std::move(socket), server_ssl_socket_factory.createTransportSocket(nullptr),
+              stream_info_);
+          server_connection->addConnectionCallbacks(server_connection_callbacks);
+        }));
+
+    std::string digest;
+    EXPECT_CALL(server_connection_callbacks, onEvent(Network::ConnectionEvent::Connected))
+        .WillOnce(Invoke([&](Network::ConnectionEvent) -> void {
+          digest = client_connection->ssl()->sha256PeerCertificateDigest();
+          server_connection->close(Network::ConnectionCloseType::NoFlush);
+          client_connection->close(Network::ConnectionCloseType::NoFlush);
+          dispatcher_->exit();
+        }));
+    EXPECT_CALL(server_connection_callbacks, onEvent(Network::ConnectionEvent::LocalClose));
+
+    dispatcher_->run(Event::Dispatcher::RunType::Block);
+    return digest;
+  };
+
+  EXPECT_EQ(TEST_SAN_DNS_CERT_256_HASH, connect("server1.example.com"));
+  EXPECT_EQ(std::vector<std::string>{"server1.example.com"}, provider->fetched_server_names_);
+  EXPECT_EQ(1UL, server_stats_store.counter("ssl.provided_certificate_cache_miss").value());
+
+  // The provider has no certificate for this name, so the configured one is used.
+  EXPECT_EQ(TEST_UNITTEST_CERT_256_HASH, connect("unknown.example.com"));
+  EXPECT_EQ(2UL, provider->fetched_server_names_.size());
+
+  // SNI is case-insensitive and the fetched certificate is now cached.
+  EXPECT_EQ(TEST_SAN_DNS_CERT_256_HASH, connect("Server1.Example.com"));
+  EXPECT_EQ(2UL, provider->fetched_server_names_.size());
+  EXPECT_EQ(1UL, server_stats_store.counter("ssl.provided_certificate_cache_hit").value());
+
+  // The provider having no certificate is cached as well, until the negative cache TTL expires.
+  EXPECT_EQ(TEST_UNITTEST_CERT_256_HASH, connect("unknown.example.com"));
+  EXPECT_EQ(2UL, provider->fetched_server_names_.size());
+  EXPECT_EQ(2UL, server_stats_store.counter("ssl.provided_certificate_cache_hit").value());
+  time_system_.advanceTimeWait(std::chrono::seconds(30));
+  EXPECT_EQ(TEST_UNITTEST_CERT_256_HASH, connect("unknown.example.com"));
+  EXPECT_EQ(3UL, provider->fetched_server_names_.size());
+  EXPECT_EQ(3UL, server_stats_store.counter("ssl.provided_certificate_cache_miss").value());
+  EXPECT_EQ(5UL, server_stats_store.counter("ssl.handshake").value());
+}
+
 namespace {
 
 // Test connecting with a client to server1, then trying to reuse the session on server2
@@ -114,6 +114,12 @@ MockListenerFilter::~MockListenerFilter() { destroy_(); }
 
 MockListenerFilterCallbacks::MockListenerFilterCallbacks() {
   ON_CALL(*this, socket()).WillByDefault(ReturnRef(socket_));
+  ON_CALL(*this, listenerFilterBuffer()).WillByDefault(Invoke([this]() -> ListenerFilterBuffer& {
+    if (listener_filter_buffer_ == nullptr) {
+      listener_filter_buffer_ = std::make_unique<ListenerFilterBufferImpl>(socket().ioHandle());
+    }
+    return *listener_filter_buffer_;
+  }));
 }
 MockListenerFilterCallbacks::~MockListenerFilterCallbacks() = default;
 
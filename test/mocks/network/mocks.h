@@ -20,6 +20,7 @@
 
 #include "source/common/network/dns_resolver/dns_factory_util.h"
 #include "source/common/network/filter_manager_impl.h"
+#include "source/common/network/listener_filter_buffer_impl.h"
 #include "source/common/network/socket_interface.h"
 #include "source/common/network/socket_interface_impl.h"
 #include "source/common/stats/isolated_store_impl.h"
@@ -373,8 +374,11 @@ public:
   MOCK_METHOD(envoy::config::core::v3::Metadata&, dynamicMetadata, ());
   MOCK_METHOD(const envoy::config::core::v3::Metadata&, dynamicMetadata, (), (const));
   MOCK_METHOD(StreamInfo::FilterState&, filterState, (), ());
+  MOCK_METHOD(ListenerFilterBuffer&, listenerFilterBuffer, ());
 
   NiceMock<MockConnectionSocket> socket_;
+  // Created on first use so that it peeks at the IoHandle of whichever socket() the test returns.
+  std::unique_ptr<ListenerFilterBufferImpl> listener_filter_buffer_;
 };
 
 class MockListenSocketFactory : public ListenSocketFactory {
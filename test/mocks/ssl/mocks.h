@@ -132,6 +132,9 @@ public:
   MOCK_METHOD(OcspStaplePolicy, ocspStaplePolicy, (), (const));
   MOCK_METHOD(const std::vector<SessionTicketKey>&, sessionTicketKeys, (), (const));
   MOCK_METHOD(bool, disableStatelessSessionResumption, (), (const));
+  MOCK_METHOD(CertificateProviderSharedPtr, certificateProvider, (), (const));
+  MOCK_METHOD(uint32_t, maxCachedProvidedCertificates, (), (const));
+  MOCK_METHOD(std::chrono::milliseconds, providedCertificateNegativeCacheTtl, (), (const));
 };
 
 class MockTlsCertificateConfig : public TlsCertificateConfig {